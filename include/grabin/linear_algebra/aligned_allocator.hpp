@@ -0,0 +1,143 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_ALIGNED_ALLOCATOR_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_ALIGNED_ALLOCATOR_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/aligned_allocator.hpp
+ @brief Распределитель памяти, выравнивающий начало блоков по границе кэш-линии
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Распределитель памяти, возвращающий блоки, выравненные по заданной границе
+    @tparam T тип элементов
+    @tparam Alignment выравнивание в байтах, по умолчанию --- размер кэш-линии
+
+    Память запрашивается у <tt> ::operator new </tt> с запасом, а адрес исходного блока
+    сохраняется непосредственно перед выравненным блоком.
+    */
+    template <class T, std::size_t Alignment = 64>
+    class aligned_allocator
+    {
+        static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0,
+                      "Alignment must be a power of two");
+        static_assert(Alignment >= alignof(T), "Alignment is less than alignof(T)");
+        static_assert(Alignment >= alignof(void *), "Alignment is less than alignof(void*)");
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Все объекты этого типа взаимозаменяемы
+        using is_always_equal = std::true_type;
+
+        /** @brief Тип распределителя для элементов другого типа
+        @tparam U тип элементов
+        */
+        template <class U>
+        struct rebind
+        {
+            /// @brief Тип распределителя для элементов типа @c U
+            using other = aligned_allocator<U, Alignment>;
+        };
+
+        /// @brief Выравнивание в байтах
+        static constexpr std::size_t alignment = Alignment;
+
+        // Создание, копирование, уничтожение
+        /// @brief Конструктор без параметров
+        aligned_allocator() = default;
+
+        /** @brief Конструктор на основе распределителя для элементов другого типа
+        @param other распределитель
+        */
+        template <class U>
+        aligned_allocator(aligned_allocator<U, Alignment> const & other) noexcept
+        {
+            static_cast<void>(other);
+        }
+
+        // Выделение и освобождение памяти
+        /** @brief Выделение памяти
+        @param n количество элементов
+        @return Указатель на блок памяти для @c n элементов, адрес которого кратен @c Alignment
+        @throw bad_alloc, если не удалось выделить память
+        */
+        T * allocate(std::size_t n)
+        {
+            auto const overhead = Alignment - 1 + sizeof(void *);
+
+            if(n > (std::numeric_limits<std::size_t>::max() - overhead) / sizeof(T))
+            {
+                throw std::bad_alloc();
+            }
+
+            auto const raw = ::operator new(n * sizeof(T) + overhead);
+
+            auto const address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *);
+            auto const aligned = (address + Alignment - 1) & ~std::uintptr_t(Alignment - 1);
+
+            reinterpret_cast<void **>(aligned)[-1] = raw;
+
+            return reinterpret_cast<T *>(aligned);
+        }
+
+        /** @brief Освобождение памяти
+        @param p указатель, полученный от @c allocate
+        @param n количество элементов, переданное @c allocate
+        */
+        void deallocate(T * p, std::size_t n) noexcept
+        {
+            static_cast<void>(n);
+
+            ::operator delete(reinterpret_cast<void **>(p)[-1]);
+        }
+
+        // Сравнение
+        //@{
+        /** @brief Сравнение распределителей
+        @return Память, выделенная одним распределителем, может быть освобождена другим
+        */
+        friend bool operator==(aligned_allocator const &, aligned_allocator const &)
+        {
+            return true;
+        }
+
+        friend bool operator!=(aligned_allocator const &, aligned_allocator const &)
+        {
+            return false;
+        }
+        //@}
+    };
+
+    template <class T, std::size_t Alignment>
+    constexpr std::size_t aligned_allocator<T, Alignment>::alignment;
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_ALIGNED_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,590 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_BLAS_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_BLAS_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/blas.hpp
+ @brief Операции BLAS над векторами и симметричными матрицами
+
+ Первый уровень: скалярное произведение, норма, сумма модулей, индекс элемента с наибольшим
+ модулем и прибавление вектора, умноженного на скаляр. Второй уровень: произведение симметричной
+ матрицы на вектор.
+
+ Функции принимают любые вектора: @c math_vector, @c static_math_vector, представления и
+ выражения. Для векторов с непрерывным хранением (имеющих функцию-член @c data) используются
+ векторизованные ядра из @c grabin/linear_algebra/simd.hpp, для остальных &mdash; обычный цикл с
+ тем же порядком операций, так что результаты для вектора и для его представления совпадают.
+*/
+
+#include <grabin/linear_algebra/simd.hpp>
+#include <grabin/linear_algebra/symmetric_matrix.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /// @brief Способы суммирования в редукциях
+    enum class summation_mode
+    {
+        /** @brief Суммирование с фиксированным количеством частичных сумм (см.
+        <tt> simd::reduction_lanes </tt>): самый быстрый способ, погрешность растёт линейно с
+        длиной вектора, делённой на количество частичных сумм
+        */
+        lanewise,
+
+        /** @brief Попарное суммирование: вектор делится на блоки, суммы блоков складываются
+        попарно, погрешность растёт как логарифм длины вектора
+        */
+        pairwise,
+
+        /** @brief Компенсированное суммирование (алгоритм Ноймайера), для чисел с плавающей точкой
+        также учитываются погрешности округления произведений: погрешность почти не зависит от
+        длины вектора, но суммирование не векторизуется
+        */
+        compensated
+    };
+
+namespace details
+{
+    template <class Vector>
+    typename Vector::dimension_type
+    iamax(Vector const & x)
+    {
+        using std::abs;
+        using Index = typename Vector::dimension_type;
+
+        if(x.dim() == 0)
+        {
+            return x.dim();
+        }
+
+        auto result = Index{0};
+        auto max_abs = abs(x.element(0));
+
+        for(auto i = Index{1}; i != x.dim(); ++ i)
+        {
+            auto const current = abs(x.element(i));
+
+            if(current > max_abs)
+            {
+                result = i;
+                max_abs = current;
+            }
+        }
+
+        return result;
+    }
+
+    template <class T>
+    class neumaier_sum
+    {
+    public:
+        void add(T const & x)
+        {
+            using std::abs;
+
+            auto const t = this->sum_ + x;
+
+            if(abs(this->sum_) >= abs(x))
+            {
+                this->compensation_ += (this->sum_ - t) + x;
+            }
+            else
+            {
+                this->compensation_ += (x - t) + this->sum_;
+            }
+
+            this->sum_ = t;
+        }
+
+        void add_error(T const & error)
+        {
+            this->compensation_ += error;
+        }
+
+        T value() const
+        {
+            return this->sum_ + this->compensation_;
+        }
+
+    private:
+        T sum_ = T(0);
+        T compensation_ = T(0);
+    };
+
+    template <class T>
+    void add_product(neumaier_sum<T> & s, T const & a, T const & b, std::true_type)
+    {
+        auto const product = simd::details::rounded_product(a, b);
+
+        s.add(product);
+        s.add_error(std::fma(a, b, -product));
+    }
+
+    template <class T>
+    void add_product(neumaier_sum<T> & s, T const & a, T const & b, std::false_type)
+    {
+        s.add(simd::details::rounded_product(a, b));
+    }
+
+    template <class T>
+    void add_product(neumaier_sum<T> & s, T const & a, T const & b)
+    {
+        details::add_product(s, a, b, std::is_floating_point<T>{});
+    }
+
+    // Количество элементов в блоке попарного суммирования
+    template <class T>
+    struct pairwise_block
+     : std::integral_constant<std::size_t, 64 * simd::reduction_lanes<T>::value>
+    {};
+
+    template <class T, class BlockSum>
+    T pairwise_sum(std::size_t first, std::size_t last, BlockSum const & block_sum)
+    {
+        auto const block = pairwise_block<T>::value;
+
+        if(last - first <= block)
+        {
+            return block_sum(first, last);
+        }
+
+        auto const blocks = (last - first + block - 1) / block;
+        auto const middle = first + (blocks / 2) * block;
+
+        return details::pairwise_sum<T>(first, middle, block_sum)
+               + details::pairwise_sum<T>(middle, last, block_sum);
+    }
+
+    /* Сумма n слагаемых способом mode: block_sum(first, last) вычисляет сумму слагаемых с
+    индексами из [first; last) с частичными суммами, add_term(s, i) прибавляет i-ое слагаемое к
+    компенсированной сумме s
+    */
+    template <class T, class BlockSum, class AddTerm>
+    T reduce(std::size_t n, summation_mode mode, BlockSum const & block_sum,
+             AddTerm const & add_term)
+    {
+        switch(mode)
+        {
+        case summation_mode::pairwise:
+            return details::pairwise_sum<T>(0, n, block_sum);
+
+        case summation_mode::compensated:
+        {
+            neumaier_sum<T> s;
+
+            for(auto i = std::size_t{0}; i != n; ++ i)
+            {
+                add_term(s, i);
+            }
+
+            return s.value();
+        }
+
+        default:
+            return block_sum(0, n);
+        }
+    }
+
+    template <class Vector1, class Vector2>
+    auto dot_block(Vector1 const & x, Vector2 const & y, std::size_t first, std::size_t last, int)
+    -> decltype(simd::dot(x.data(), y.data(), last - first))
+    {
+        return simd::dot(x.data() + first, y.data() + first, last - first);
+    }
+
+    template <class Vector1, class Vector2>
+    typename Vector1::value_type
+    dot_block(Vector1 const & x, Vector2 const & y, std::size_t first, std::size_t last, long)
+    {
+        using T = typename Vector1::value_type;
+
+        return simd::details::lane_sum<T>(last - first, [&](std::size_t i)
+        {
+            return simd::details::rounded_product(T(x.element(first + i)),
+                                                  T(y.element(first + i)));
+        });
+    }
+
+    template <class Vector>
+    auto sum_abs_block(Vector const & x, std::size_t first, std::size_t last, int)
+    -> decltype(simd::sum_abs(x.data(), last - first))
+    {
+        return simd::sum_abs(x.data() + first, last - first);
+    }
+
+    template <class Vector>
+    typename Vector::value_type
+    sum_abs_block(Vector const & x, std::size_t first, std::size_t last, long)
+    {
+        using T = typename Vector::value_type;
+        using std::abs;
+
+        return simd::details::lane_sum<T>(last - first, [&](std::size_t i)
+        {
+            return T(abs(x.element(first + i)));
+        });
+    }
+
+    template <class Vector1, class Vector2>
+    typename Vector1::value_type
+    dot(Vector1 const & x, Vector2 const & y, summation_mode mode)
+    {
+        using T = typename Vector1::value_type;
+
+        auto const block_sum = [&](std::size_t first, std::size_t last)
+        {
+            return details::dot_block(x, y, first, last, 0);
+        };
+
+        auto const add_term = [&](neumaier_sum<T> & s, std::size_t i)
+        {
+            details::add_product(s, T(x.element(i)), T(y.element(i)));
+        };
+
+        return details::reduce<T>(x.dim(), mode, block_sum, add_term);
+    }
+
+    template <class Vector, class T>
+    T scaled_norm(Vector const & x, T const & scale, summation_mode mode)
+    {
+        auto const term = [&](std::size_t i) { return T(x.element(i) / scale); };
+
+        auto const block_sum = [&](std::size_t first, std::size_t last)
+        {
+            return simd::details::lane_sum<T>(last - first, [&](std::size_t i)
+            {
+                auto const z = term(first + i);
+                return simd::details::rounded_product(z, z);
+            });
+        };
+
+        auto const add_term = [&](neumaier_sum<T> & s, std::size_t i)
+        {
+            auto const z = term(i);
+            details::add_product(s, z, z);
+        };
+
+        using std::sqrt;
+        return scale * sqrt(details::reduce<T>(x.dim(), mode, block_sum, add_term));
+    }
+
+    template <class Vector, class T>
+    T norm_from_squares(Vector const & x, T const & sum_of_squares, summation_mode mode,
+                        std::true_type)
+    {
+        // Сумма квадратов может переполниться или потерять точность из-за денормализованных
+        // чисел: в этих случаях элементы предварительно делятся на наибольший модуль
+        auto const tiny = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+
+        if(std::isfinite(sum_of_squares) && sum_of_squares >= tiny)
+        {
+            return std::sqrt(sum_of_squares);
+        }
+
+        auto const index = details::iamax(x);
+
+        if(index == x.dim())
+        {
+            return T(0);
+        }
+
+        auto const scale = T(std::abs(x.element(index)));
+
+        if(scale == T(0) || !std::isfinite(scale))
+        {
+            return std::isnan(sum_of_squares) ? sum_of_squares : scale;
+        }
+
+        return details::scaled_norm(x, scale, mode);
+    }
+
+    template <class Vector, class T>
+    T norm_from_squares(Vector const &, T const & sum_of_squares, summation_mode, std::false_type)
+    {
+        using std::sqrt;
+        return sqrt(sum_of_squares);
+    }
+
+    template <class Scalar, class Vector1, class Vector2>
+    auto axpy(Scalar const & a, Vector1 const & x, Vector2 & y, int)
+    -> decltype(simd::axpy(y.data(), std::declval<typename Vector2::value_type const &>(),
+                           x.data(), std::size_t{0}))
+    {
+        using T = typename Vector2::value_type;
+
+        return simd::axpy(y.data(), T(a), x.data(), static_cast<std::size_t>(y.dim()));
+    }
+
+    template <class Scalar, class Vector1, class Vector2>
+    void axpy(Scalar const & a, Vector1 const & x, Vector2 & y, long)
+    {
+        auto const y_first = y.begin();
+
+        for(auto i = decltype(y.dim()){0}; i != y.dim(); ++ i)
+        {
+            y_first[i] += simd::details::rounded_product(a, x.element(i));
+        }
+    }
+
+    // Указатель на элементы вектора, если они хранятся непрерывно, иначе на их копию в buffer
+    template <class T, class Vector>
+    auto contiguous_elements(Vector const & x, std::vector<T> &, int)
+    -> std::enable_if_t<std::is_convertible<decltype(x.data()), T const *>::value, T const *>
+    {
+        return x.data();
+    }
+
+    template <class T, class Vector>
+    T const * contiguous_elements(Vector const & x, std::vector<T> & buffer, long)
+    {
+        buffer.resize(static_cast<std::size_t>(x.dim()));
+
+        for(auto i = decltype(x.dim()){0}; i != x.dim(); ++ i)
+        {
+            buffer[i] = x.element(i);
+        }
+
+        return buffer.data();
+    }
+
+    // Указатель на изменяемые элементы вектора, если они хранятся непрерывно, иначе nullptr
+    template <class T, class Vector>
+    auto mutable_elements(Vector & y, int)
+    -> std::enable_if_t<std::is_convertible<decltype(y.data()), T *>::value, T *>
+    {
+        return y.data();
+    }
+
+    template <class T, class Vector>
+    T * mutable_elements(Vector &, long)
+    {
+        return nullptr;
+    }
+
+    // y = beta * y, при beta == 0 элементы y обнуляются, даже если они были бесконечны или NaN
+    template <class T, class Vector>
+    void scale_vector(T const & beta, Vector & y)
+    {
+        if(beta == T(1))
+        {
+            return;
+        }
+
+        auto const y_first = y.begin();
+
+        for(auto i = decltype(y.dim()){0}; i != y.dim(); ++ i)
+        {
+            y_first[i] = (beta == T(0)) ? T(0) : T(beta * y_first[i]);
+        }
+    }
+
+    /* y += alpha * A * x по строкам нижнего треугольника из [row_first; row_last): строка i
+    даёт вклад в y[i] (скалярное произведение) и в y[0], ..., y[i-1] (прибавление строки,
+    умноженной на alpha * x[i]), так что каждый элемент матрицы загружается один раз.
+    */
+    template <class Matrix, class T>
+    void symv_rows(T const & alpha, Matrix const & A, T const * x, T * y,
+                   typename Matrix::dimension_type row_first,
+                   typename Matrix::dimension_type row_last)
+    {
+        auto const isa = simd::supported_instruction_set();
+
+        for(auto i = row_first; i < row_last; ++ i)
+        {
+            auto const row = A.row_data(i);
+            auto const n = static_cast<std::size_t>(i);
+            auto const a_i = alpha * x[i];
+
+            simd::axpy(y, a_i, row, n, isa);
+            y[i] += simd::details::rounded_product(a_i, row[i])
+                    + simd::details::rounded_product(alpha, simd::dot(row, x, n, isa));
+        }
+    }
+}
+// namespace details
+
+    /** @brief Индекс элемента с наибольшим модулем
+    @param x вектор
+    @return Наименьший индекс @c i, для которого <tt> abs(x[i]) </tt> максимален, или
+    <tt> x.dim() </tt>, если вектор пуст
+    */
+    template <class Vector>
+    typename Vector::dimension_type
+    iamax(Vector const & x)
+    {
+        return details::iamax(x);
+    }
+
+    /** @brief Скалярное произведение векторов
+    @param x, y вектора
+    @param mode способ суммирования
+    @return Сумма <tt> x[i] * y[i] </tt> для всех @c i из <tt> [0; x.dim()) </tt>
+    @throw То же, что <tt> Vector1::checking_policy::check_equal_dimensions(x, y) </tt>
+    */
+    template <class Vector1, class Vector2>
+    typename Vector1::value_type
+    dot(Vector1 const & x, Vector2 const & y, summation_mode mode = summation_mode::lanewise)
+    {
+        Vector1::checking_policy::check_equal_dimensions(x, y);
+
+        return details::dot(x, y, mode);
+    }
+
+    /** @brief Евклидова норма вектора
+    @param x вектор
+    @param mode способ суммирования
+    @return Квадратный корень из суммы квадратов элементов вектора @c x. Для чисел с плавающей
+    точкой результат не переполняется и не теряет точность из-за денормализованных чисел, если сама
+    норма представима.
+    */
+    template <class Vector>
+    typename Vector::value_type
+    nrm2(Vector const & x, summation_mode mode = summation_mode::lanewise)
+    {
+        using T = typename Vector::value_type;
+
+        return details::norm_from_squares(x, details::dot(x, x, mode), mode,
+                                          std::is_floating_point<T>{});
+    }
+
+    /** @brief Сумма модулей элементов вектора
+    @param x вектор
+    @param mode способ суммирования
+    @return Сумма <tt> abs(x[i]) </tt> для всех @c i из <tt> [0; x.dim()) </tt>
+    */
+    template <class Vector>
+    typename Vector::value_type
+    asum(Vector const & x, summation_mode mode = summation_mode::lanewise)
+    {
+        using T = typename Vector::value_type;
+
+        auto const block_sum = [&](std::size_t first, std::size_t last)
+        {
+            return details::sum_abs_block(x, first, last, 0);
+        };
+
+        auto const add_term = [&](details::neumaier_sum<T> & s, std::size_t i)
+        {
+            using std::abs;
+            s.add(T(abs(x.element(i))));
+        };
+
+        return details::reduce<T>(x.dim(), mode, block_sum, add_term);
+    }
+
+    /** @brief Прибавление вектора, умноженного на скаляр
+    @param a множитель
+    @param x прибавляемый вектор
+    @param y изменяемый вектор или представление
+    @post <tt> y[i] += a * x[i] </tt> для всех @c i из <tt> [0; y.dim()) </tt>
+    @throw То же, что <tt> checking_policy::check_equal_dimensions(x, y) </tt>, где
+    @c checking_policy &mdash; стратегия проверок вектора @c y
+    */
+    template <class Scalar, class Vector1, class Vector2>
+    void axpy(Scalar const & a, Vector1 const & x, Vector2 && y)
+    {
+        using Checking = typename std::remove_reference_t<Vector2>::checking_policy;
+        Checking::check_equal_dimensions(x, y);
+
+        details::axpy(a, x, y, 0);
+    }
+
+    /** @brief Произведение симметричной матрицы на вектор
+    @param alpha множитель произведения
+    @param A симметричная матрица, строки нижнего треугольника которой доступны через
+    <tt> A.row_data(i) </tt> (например, @c symmetric_matrix)
+    @param x вектор
+    @param beta множитель вектора @c y
+    @param y изменяемый вектор или представление
+    @pre @c x и @c y не перекрываются
+    @post <tt> y = alpha * A * x + beta * y </tt>. Если <tt> beta == 0 </tt>, то исходные
+    значения @c y не используются (в том числе бесконечности и NaN).
+    @throw То же, что <tt> checking_policy::check_equal_dimensions </tt> для @c A и @c x, а также
+    для @c A и @c y, где @c checking_policy &mdash; стратегия проверок матрицы
+
+    Упакованный треугольник читается один раз, строка за строкой: каждая строка используется и
+    как строка, и как столбец матрицы. Если элементы @c x или @c y не хранятся непрерывно, то
+    вычисления выполняются с их копиями, а результат не меняется.
+    */
+    template <class Matrix, class Vector1, class Vector2>
+    void symv(typename Matrix::value_type const & alpha, Matrix const & A, Vector1 const & x,
+              typename Matrix::value_type const & beta, Vector2 && y)
+    {
+        using T = typename Matrix::value_type;
+        using Checking = typename Matrix::checking_policy;
+
+        Checking::check_equal_dimensions(A, x);
+        Checking::check_equal_dimensions(A, y);
+
+        details::scale_vector(beta, y);
+
+        if(alpha == T(0))
+        {
+            return;
+        }
+
+        std::vector<T> x_buffer;
+        auto const x_data = details::contiguous_elements(x, x_buffer, 0);
+
+        if(auto const y_data = details::mutable_elements<T>(y, 0))
+        {
+            details::symv_rows(alpha, A, x_data, y_data, 0, A.dim());
+        }
+        else
+        {
+            std::vector<T> y_buffer;
+            details::contiguous_elements(y, y_buffer, 0);
+            details::symv_rows(alpha, A, x_data, y_buffer.data(), 0, A.dim());
+
+            auto const y_first = y.begin();
+
+            for(auto i = 0*A.dim(); i < A.dim(); ++ i)
+            {
+                y_first[i] = y_buffer[i];
+            }
+        }
+    }
+
+    /** @brief Произведение симметричной матрицы на вектор
+    @param A матрица
+    @param x вектор
+    @return Вектор <tt> A * x </tt>, использующий копию распределителя памяти @c A
+    @throw То же, что <tt> Check::check_equal_dimensions(A, x) </tt>
+    */
+    template <class T, class Check, class Alloc, class Layout, class E,
+              class = std::enable_if_t<is_vector_expression<std::decay_t<E>>::value>>
+    math_vector<T, Check, Alloc>
+    operator*(symmetric_matrix<T, Check, Alloc, Layout> const & A, E && x)
+    {
+        math_vector<T, Check, Alloc> result(A.dim(), A.get_allocator());
+        ::grabin::symv(T(1), A, x, T(0), result);
+        return result;
+    }
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_BLAS_HPP_INCLUDED
@@ -0,0 +1,535 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_CHOLESKY_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_CHOLESKY_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/cholesky.hpp
+ @brief Разложение Холецкого симметричных матриц и решение систем линейных уравнений
+
+ Разложения выполняются на месте: нижний треугольник @c symmetric_matrix заменяется множителем
+ разложения, так что копирование матрицы в другой формат не требуется. Строки нижнего
+ треугольника хранятся в памяти подряд, поэтому все внутренние циклы являются скалярными
+ произведениями или прибавлениями строк и используют векторизованные ядра из
+ @c grabin/linear_algebra/simd.hpp.
+*/
+
+#include <grabin/linear_algebra/blas.hpp>
+#include <grabin/linear_algebra/symmetric_matrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Исключение, выбрасываемое, если матрицу не удаётся разложить
+
+    Для разложения Холецкого это означает, что матрица не является положительно определённой
+    (с учётом ошибок округления), для разложения @f$ LDL^T @f$ &mdash; что встретился нулевой
+    ведущий элемент.
+    */
+    class factorization_error
+     : public std::runtime_error
+    {
+    public:
+        /** @brief Конструктор
+        @param message описание ошибки
+        @param pivot номер строки, на которой разложение прервалось
+        @post <tt> this->pivot() == pivot </tt>
+        */
+        factorization_error(std::string const & message, std::ptrdiff_t pivot)
+         : std::runtime_error(message)
+         , pivot_(pivot)
+        {}
+
+        /** @brief Номер строки, на которой разложение прервалось
+        @return Номер строки, ведущий элемент которой оказался недопустимым
+        */
+        std::ptrdiff_t pivot() const
+        {
+            return this->pivot_;
+        }
+
+    private:
+        std::ptrdiff_t pivot_;
+    };
+
+namespace details
+{
+    template <class T>
+    [[noreturn]] void throw_factorization_error(char const * reason, std::ptrdiff_t row,
+                                                T const & pivot)
+    {
+        std::ostringstream os;
+        os << reason << ": row = " << row << ", pivot = " << pivot;
+        throw factorization_error(os.str(), row);
+    }
+
+    // Количество элементов полосы строк, обрабатываемых вместе: полоса должна помещаться в кэш
+    // второго уровня, тогда каждая предыдущая строка загружается из памяти один раз на полосу
+    template <class T>
+    struct factorization_band
+     : std::integral_constant<std::ptrdiff_t, std::ptrdiff_t(128 * 1024 / sizeof(T))>
+    {};
+
+    template <class Matrix>
+    typename Matrix::dimension_type
+    factorization_band_end(Matrix const & A, typename Matrix::dimension_type row_first)
+    {
+        using T = typename Matrix::value_type;
+
+        auto row_last = row_first + 1;
+
+        while(row_last < A.dim()
+              && A.row_data(row_last) - A.row_data(row_first) + row_last + 1
+                 <= factorization_band<T>::value)
+        {
+            ++ row_last;
+        }
+
+        return row_last;
+    }
+
+    /* Решение системы L y = b (прямая подстановка), где L хранится в нижнем треугольнике F; если
+    Unit, то диагональ L считается единичной
+    */
+    template <bool Unit, class Matrix, class T>
+    void forward_substitution(Matrix const & F, T * b)
+    {
+        auto const isa = simd::supported_instruction_set();
+
+        for(auto i = 0*F.dim(); i < F.dim(); ++ i)
+        {
+            auto const row = F.row_data(i);
+
+            b[i] -= simd::dot(row, b, static_cast<std::size_t>(i), isa);
+
+            if(!Unit)
+            {
+                b[i] /= row[i];
+            }
+        }
+    }
+
+    // Решение системы L^T x = b (обратная подстановка), L хранится в нижнем треугольнике F
+    template <bool Unit, class Matrix, class T>
+    void back_substitution(Matrix const & F, T * b)
+    {
+        auto const isa = simd::supported_instruction_set();
+
+        for(auto i = F.dim(); i > 0; -- i)
+        {
+            auto const row = F.row_data(i - 1);
+
+            if(!Unit)
+            {
+                b[i - 1] /= row[i - 1];
+            }
+
+            simd::axpy(b, T(-b[i - 1]), row, static_cast<std::size_t>(i - 1), isa);
+        }
+    }
+
+    template <class Matrix, class T>
+    void divide_by_diagonal(Matrix const & F, T * b)
+    {
+        for(auto i = 0*F.dim(); i < F.dim(); ++ i)
+        {
+            b[i] /= F.row_data(i)[i];
+        }
+    }
+
+    /* Прямая подстановка для k правых частей, хранящихся в B построчно: B[i*k + r] &mdash;
+    i-ый элемент r-ой правой части. Каждый элемент L загружается один раз для всех k правых частей.
+    */
+    template <bool Unit, class Matrix, class T>
+    void forward_substitution(Matrix const & F, T * B, std::size_t k)
+    {
+        for(auto i = 0*F.dim(); i < F.dim(); ++ i)
+        {
+            auto const row = F.row_data(i);
+            auto const b_i = B + i * k;
+
+            for(auto j = 0*i; j < i; ++ j)
+            {
+                auto const l = row[j];
+                auto const b_j = B + j * k;
+
+                for(auto r = std::size_t{0}; r != k; ++ r)
+                {
+                    b_i[r] -= l * b_j[r];
+                }
+            }
+
+            if(!Unit)
+            {
+                for(auto r = std::size_t{0}; r != k; ++ r)
+                {
+                    b_i[r] /= row[i];
+                }
+            }
+        }
+    }
+
+    template <bool Unit, class Matrix, class T>
+    void back_substitution(Matrix const & F, T * B, std::size_t k)
+    {
+        for(auto i = F.dim(); i > 0; -- i)
+        {
+            auto const row = F.row_data(i - 1);
+            auto const b_i = B + (i - 1) * k;
+
+            if(!Unit)
+            {
+                for(auto r = std::size_t{0}; r != k; ++ r)
+                {
+                    b_i[r] /= row[i - 1];
+                }
+            }
+
+            for(auto j = 0*i; j < i - 1; ++ j)
+            {
+                auto const l = row[j];
+                auto const b_j = B + j * k;
+
+                for(auto r = std::size_t{0}; r != k; ++ r)
+                {
+                    b_j[r] -= l * b_i[r];
+                }
+            }
+        }
+    }
+
+    template <class Matrix, class T>
+    void divide_by_diagonal(Matrix const & F, T * B, std::size_t k)
+    {
+        for(auto i = 0*F.dim(); i < F.dim(); ++ i)
+        {
+            auto const d = F.row_data(i)[i];
+            auto const b_i = B + i * k;
+
+            for(auto r = std::size_t{0}; r != k; ++ r)
+            {
+                b_i[r] /= d;
+            }
+        }
+    }
+
+    // Решение системы для одной правой части: solver(T*) работает с непрерывным массивом
+    template <class Matrix, class Vector, class Solver>
+    void solve_in_place(Matrix const & F, Vector & b, Solver solver)
+    {
+        using T = typename Matrix::value_type;
+
+        Matrix::checking_policy::check_equal_dimensions(F, b);
+
+        if(auto const b_data = details::mutable_elements<T>(b, 0))
+        {
+            solver(b_data);
+        }
+        else
+        {
+            std::vector<T> buffer;
+            details::contiguous_elements(b, buffer, 0);
+
+            solver(buffer.data());
+
+            auto const b_first = b.begin();
+
+            for(auto i = 0*F.dim(); i < F.dim(); ++ i)
+            {
+                b_first[i] = buffer[i];
+            }
+        }
+    }
+
+    /* Решение систем для последовательности правых частей: они обрабатываются блоками, каждый
+    блок копируется в буфер, в котором элементы разных правых частей чередуются
+    */
+    template <class Matrix, class ForwardIterator, class Solver>
+    void solve_in_place(Matrix const & F, ForwardIterator first, ForwardIterator last,
+                        Solver solver)
+    {
+        using T = typename Matrix::value_type;
+
+        auto const n = static_cast<std::size_t>(F.dim());
+        auto const block_size = std::size_t{16};
+
+        std::vector<T> block;
+        block.reserve(n * block_size);
+
+        while(first != last)
+        {
+            auto block_last = first;
+            auto k = std::size_t{0};
+
+            for(; block_last != last && k < block_size; ++ block_last, ++ k)
+            {
+                Matrix::checking_policy::check_equal_dimensions(F, *block_last);
+            }
+
+            block.assign(n * k, T(0));
+
+            auto r = std::size_t{0};
+            for(auto pos = first; pos != block_last; ++ pos, ++ r)
+            {
+                auto const & b = *pos;
+
+                for(auto i = std::size_t{0}; i != n; ++ i)
+                {
+                    block[i * k + r] = b.element(i);
+                }
+            }
+
+            solver(block.data(), k);
+
+            r = 0;
+            for(; first != block_last; ++ first, ++ r)
+            {
+                auto const b_first = (*first).begin();
+
+                for(auto i = std::size_t{0}; i != n; ++ i)
+                {
+                    b_first[i] = block[i * k + r];
+                }
+            }
+        }
+    }
+}
+// namespace details
+
+    /** @brief Разложение Холецкого на месте
+    @param A симметричная положительно определённая матрица
+    @post Нижний треугольник @c A содержит нижнетреугольную матрицу @c L с положительной
+    диагональю, такую что исходная матрица равна <tt> L * L^T </tt>: <tt> A(i, j) == L(i, j) </tt>
+    для <tt> j <= i </tt>
+    @throw factorization_error, если матрица не является положительно определённой, то есть
+    очередной ведущий элемент не положителен (или равен NaN). В этом случае строки с номерами,
+    меньшими <tt> pivot() </tt>, уже заменены строками множителя, остальные могут быть изменены.
+
+    Строки обрабатываются полосами, помещающимися в кэш: каждая предыдущая строка загружается из
+    памяти один раз на полосу, а не один раз на строку. Порядок операций для каждого элемента
+    множителя такой же, как и без разбиения на полосы.
+    */
+    template <class T, class Check, class Alloc, class Layout>
+    void cholesky_factorize(symmetric_matrix<T, Check, Alloc, Layout> & A)
+    {
+        auto const isa = simd::supported_instruction_set();
+        auto const n = A.dim();
+
+        for(auto row_first = 0*n; row_first < n;)
+        {
+            auto const row_last = details::factorization_band_end(A, row_first);
+
+            for(auto j = 0*n; j < row_last; ++ j)
+            {
+                auto const row_j = A.row_data(j);
+                auto const j_size = static_cast<std::size_t>(j);
+
+                if(j >= row_first)
+                {
+                    auto const d = row_j[j] - simd::dot(row_j, row_j, j_size, isa);
+
+                    if(!(d > T(0)))
+                    {
+                        details::throw_factorization_error("Matrix is not positive definite", j, d);
+                    }
+
+                    using std::sqrt;
+                    row_j[j] = sqrt(d);
+                }
+
+                for(auto i = std::max(row_first, j + 1); i < row_last; ++ i)
+                {
+                    auto const row_i = A.row_data(i);
+
+                    row_i[j] = (row_i[j] - simd::dot(row_i, row_j, j_size, isa)) / row_j[j];
+                }
+            }
+
+            row_first = row_last;
+        }
+    }
+
+    /** @brief Разложение @f$ LDL^T @f$ на месте
+    @param A симметричная матрица, все ведущие главные миноры которой отличны от нуля
+    @post Нижний треугольник @c A без диагонали содержит нижнетреугольную матрицу @c L с
+    единичной диагональю, а диагональ @c A &mdash; диагональную матрицу @c D, такие что исходная
+    матрица равна <tt> L * D * L^T </tt>
+    @throw factorization_error, если очередной ведущий элемент равен нулю или не является конечным
+    числом
+
+    В отличие от разложения Холецкого, не требует вычисления квадратных корней и применимо к
+    знаконеопределённым матрицам, но выполняется без выбора ведущего элемента, поэтому для плохо
+    обусловленных знаконеопределённых матриц может быть неустойчивым.
+    */
+    template <class T, class Check, class Alloc, class Layout>
+    void ldlt_factorize(symmetric_matrix<T, Check, Alloc, Layout> & A)
+    {
+        auto const isa = simd::supported_instruction_set();
+        auto const n = A.dim();
+
+        // Пока строка i не завершена, в ней хранятся произведения L(i, k) * D(k)
+        for(auto row_first = 0*n; row_first < n;)
+        {
+            auto const row_last = details::factorization_band_end(A, row_first);
+
+            for(auto j = 0*n; j < row_last; ++ j)
+            {
+                auto const row_j = A.row_data(j);
+
+                if(j >= row_first)
+                {
+                    auto d = row_j[j];
+
+                    for(auto k = 0*j; k < j; ++ k)
+                    {
+                        auto const l = row_j[k] / A.row_data(k)[k];
+                        d -= row_j[k] * l;
+                        row_j[k] = l;
+                    }
+
+                    using std::isfinite;
+                    if(d == T(0) || !isfinite(d))
+                    {
+                        details::throw_factorization_error("Zero pivot in LDL^T factorization",
+                                                           j, d);
+                    }
+
+                    row_j[j] = d;
+                }
+
+                for(auto i = std::max(row_first, j + 1); i < row_last; ++ i)
+                {
+                    auto const row_i = A.row_data(i);
+
+                    row_i[j] -= simd::dot(row_i, row_j, static_cast<std::size_t>(j), isa);
+                }
+            }
+
+            row_first = row_last;
+        }
+    }
+
+    /** @brief Прямая подстановка: решение системы <tt> L * y = b </tt>
+    @param L матрица, нижний треугольник которой содержит множитель разложения Холецкого
+    @param b правая часть, заменяется решением
+    @throw То же, что <tt> Check::check_equal_dimensions(L, b) </tt>
+
+    Например, квадрат расстояния Махаланобиса <tt> x^T A^{-1} x </tt> равен квадрату нормы
+    решения системы <tt> L * y = x </tt>.
+    */
+    template <class T, class Check, class Alloc, class Layout, class Vector>
+    void cholesky_forward_substitution(symmetric_matrix<T, Check, Alloc, Layout> const & L,
+                                       Vector && b)
+    {
+        details::solve_in_place(L, b, [&](T * x)
+        {
+            details::forward_substitution<false>(L, x);
+        });
+    }
+
+    /** @brief Обратная подстановка: решение системы <tt> L^T * x = b </tt>
+    @param L матрица, нижний треугольник которой содержит множитель разложения Холецкого
+    @param b правая часть, заменяется решением
+    @throw То же, что <tt> Check::check_equal_dimensions(L, b) </tt>
+    */
+    template <class T, class Check, class Alloc, class Layout, class Vector>
+    void cholesky_back_substitution(symmetric_matrix<T, Check, Alloc, Layout> const & L,
+                                    Vector && b)
+    {
+        details::solve_in_place(L, b, [&](T * x)
+        {
+            details::back_substitution<false>(L, x);
+        });
+    }
+
+    //@{
+    /** @brief Решение систем линейных уравнений с помощью разложения Холецкого
+    @param L матрица, к которой применили @c cholesky_factorize
+    @param b правая часть, заменяется решением
+    @param first, last интервал, задающий последовательность правых частей, каждая из которых
+    заменяется решением соответствующей системы
+    @throw То же, что <tt> Check::check_equal_dimensions </tt> для @c L и каждой правой части
+
+    Правые части последовательности обрабатываются блоками, так что каждый элемент множителя
+    загружается один раз на блок, а не на каждую правую часть.
+    */
+    template <class T, class Check, class Alloc, class Layout, class Vector>
+    void cholesky_solve(symmetric_matrix<T, Check, Alloc, Layout> const & L, Vector && b)
+    {
+        details::solve_in_place(L, b, [&](T * x)
+        {
+            details::forward_substitution<false>(L, x);
+            details::back_substitution<false>(L, x);
+        });
+    }
+
+    template <class T, class Check, class Alloc, class Layout, class ForwardIterator>
+    void cholesky_solve(symmetric_matrix<T, Check, Alloc, Layout> const & L,
+                        ForwardIterator first, ForwardIterator last)
+    {
+        details::solve_in_place(L, first, last, [&](T * B, std::size_t k)
+        {
+            details::forward_substitution<false>(L, B, k);
+            details::back_substitution<false>(L, B, k);
+        });
+    }
+    //@}
+
+    //@{
+    /** @brief Решение систем линейных уравнений с помощью разложения @f$ LDL^T @f$
+    @param F матрица, к которой применили @c ldlt_factorize
+    @param b правая часть, заменяется решением
+    @param first, last интервал, задающий последовательность правых частей, каждая из которых
+    заменяется решением соответствующей системы
+    @throw То же, что <tt> Check::check_equal_dimensions </tt> для @c F и каждой правой части
+    */
+    template <class T, class Check, class Alloc, class Layout, class Vector>
+    void ldlt_solve(symmetric_matrix<T, Check, Alloc, Layout> const & F, Vector && b)
+    {
+        details::solve_in_place(F, b, [&](T * x)
+        {
+            details::forward_substitution<true>(F, x);
+            details::divide_by_diagonal(F, x);
+            details::back_substitution<true>(F, x);
+        });
+    }
+
+    template <class T, class Check, class Alloc, class Layout, class ForwardIterator>
+    void ldlt_solve(symmetric_matrix<T, Check, Alloc, Layout> const & F,
+                    ForwardIterator first, ForwardIterator last)
+    {
+        details::solve_in_place(F, first, last, [&](T * B, std::size_t k)
+        {
+            details::forward_substitution<true>(F, B, k);
+            details::divide_by_diagonal(F, B, k);
+            details::back_substitution<true>(F, B, k);
+        });
+    }
+    //@}
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_CHOLESKY_HPP_INCLUDED
@@ -20,10 +20,19 @@
  @brief Векторы и связанные с ними функции
 */
 
+#include <grabin/linear_algebra/aligned_allocator.hpp>
+#include <grabin/linear_algebra/simd.hpp>
+#include <grabin/linear_algebra/vector_expression.hpp>
+
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
 
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
 namespace grabin
 {
 inline namespace v0
@@ -38,22 +47,20 @@ inline namespace v0
         @throw logic_error, если <tt> index < 0 || index >= x.dim() </tt>
         */
         template <class Vector>
-        static void check_index(Vector const & x, typename Vector::dimension_type index)
+        static constexpr void check_index(Vector const & x, typename Vector::dimension_type index)
         {
             if(index < 0 || index >= x.dim())
             {
-                std::ostringstream os;
-                os << "Incorrect index = " << index << ", dimension = " << x.dim();
-                throw std::logic_error(os.str());
+                vector_policy_throws::throw_incorrect_index(index, x.dim());
             }
         }
 
-        /** @brief Проверка индекса
+        /** @brief Проверка совпадения размерностей
         @param x, y вектора
         @throw logic_error, если <tt> x.dim() != y.dim() </tt>
         */
-        template <class Vector>
-        static void check_equal_dimensions(Vector const & x, Vector const & y)
+        template <class Vector1, class Vector2>
+        static constexpr void check_equal_dimensions(Vector1 const & x, Vector2 const & y)
         {
             if(x.dim() != y.dim())
             {
@@ -66,23 +73,34 @@ inline namespace v0
         @throw logic_error, если <tt> x != T{0} </tt>
         */
         template <class Scalar>
-        static void check_divisor_is_not_zero(Scalar const & x)
+        static constexpr void check_divisor_is_not_zero(Scalar const & x)
         {
             if(x == Scalar{0})
             {
                 throw std::logic_error("Division by zero");
             }
         }
+
+    private:
+        template <class Index>
+        [[noreturn]] static void throw_incorrect_index(Index const & index, Index const & dim)
+        {
+            std::ostringstream os;
+            os << "Incorrect index = " << index << ", dimension = " << dim;
+            throw std::logic_error(os.str());
+        }
     };
 
     /** @brief Класс "математического вектора
     @tparam T тип элементов
     @tparam Checking стратегия проверок и обработки ошибок
+    @tparam Alloc тип распределителя памяти
     */
-    template <class T, class Checking = vector_policy_throws>
+    template <class T, class Checking = vector_policy_throws, class Alloc = std::allocator<T>>
     class math_vector
+     : public vector_expression<math_vector<T, Checking, Alloc>>
     {
-        using Data = std::vector<T>;
+        using Data = std::vector<T, Alloc>;
     public:
         // Типы
         /// @brief Тип элементов
@@ -91,6 +109,9 @@ inline namespace v0
         /// @brief Стратегия проверки и обработки ошибок
         using checking_policy = Checking;
 
+        /// @brief Тип распределителя памяти
+        using allocator_type = Alloc;
+
         /// @brief Тип размерности и индексов
         using dimension_type = typename Data::difference_type;
 
@@ -106,24 +127,107 @@ inline namespace v0
 
         /** @brief Создаёт нулевой вектор заданной размерности
         @param n размерность
+        @param alloc распределитель памяти
         @post <tt> this->dim() == n </tt>
         @post Для любого @c i из интервала <tt> [0; this->dim()) </tt> выполняется
         <tt> (*this)[i] == T(0) </tt>
         */
-        explicit math_vector(dimension_type n)
-         : data_(n, T(0))
+        explicit math_vector(dimension_type n, Alloc const & alloc = Alloc())
+         : data_(n, T(0), alloc)
         {}
 
         /** @brief Создаёт вектор с элементами из списка инициализации
         @param init список элементов
+        @param alloc распределитель памяти
         @post <tt> this->dim() == init.size() </tt>
         @post Для любого @c i из интервала <tt> [0; this->dim()) </tt> выполняется
         <tt> (*this)[i] == *(init.begin() + i) </tt>
         */
-        math_vector(std::initializer_list<T> init)
-         : data_(std::move(init))
+        math_vector(std::initializer_list<T> init, Alloc const & alloc = Alloc())
+         : data_(std::move(init), alloc)
+        {}
+
+        /** @brief Создаёт копию вектора, использующую заданный распределитель памяти
+        @param x копируемый вектор
+        @param alloc распределитель памяти
+        @post <tt> *this == x </tt>
+        */
+        math_vector(math_vector const & x, Alloc const & alloc)
+         : data_(x.data_, alloc)
         {}
 
+        /** @brief Создаёт вектор, вычисляя значение векторного выражения
+        @param x векторное выражение
+        @post <tt> this->dim() == x.dim() </tt>
+        @post Для любого @c i из интервала <tt> [0; this->dim()) </tt> выполняется
+        <tt> (*this)[i] == x[i] </tt>
+
+        Если у выражения есть распределитель памяти, из которого можно построить @c Alloc
+        (например, выражение содержит векторы с тем же типом распределителя), то вектор
+        использует его копию, иначе --- <tt> Alloc() </tt>.
+        */
+        template <class E>
+        math_vector(vector_expression<E> const & x)
+         : math_vector(x, details::allocator_for<Alloc>(x.derived(), 0))
+        {}
+
+        /** @brief Создаёт вектор, вычисляя значение векторного выражения
+        @param x векторное выражение
+        @param alloc распределитель памяти
+        @post <tt> this->dim() == x.dim() </tt>
+        @post Для любого @c i из интервала <tt> [0; this->dim()) </tt> выполняется
+        <tt> (*this)[i] == x[i] </tt>
+        */
+        template <class E>
+        math_vector(vector_expression<E> const & x, Alloc const & alloc)
+         : data_(alloc)
+        {
+            auto const & expr = x.derived();
+
+            this->data_.reserve(expr.dim());
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
+            {
+                this->data_.emplace_back(expr.element(i));
+            }
+        }
+
+        /** @brief Присваивание значения векторного выражения
+        @param x векторное выражение
+        @post <tt> this->dim() == x.dim() </tt>
+        @post Для любого @c i из интервала <tt> [0; this->dim()) </tt> выполняется
+        <tt> (*this)[i] == x[i] </tt>
+        @return <tt> *this </tt>
+
+        Так как все векторные выражения поэлементные, выражение может содержать <tt> *this </tt>.
+        Если размерности совпадают, то выражение вычисляется за один проход без выделения памяти.
+        */
+        template <class E>
+        math_vector & operator=(vector_expression<E> const & x)
+        {
+            auto const & expr = x.derived();
+
+            if(expr.dim() != this->dim())
+            {
+                return *this = math_vector(x, this->get_allocator());
+            }
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
+            {
+                this->data_[i] = expr.element(i);
+            }
+
+            return *this;
+        }
+
+        /** @brief Распределитель памяти
+        @return Копия распределителя памяти, используемого вектором
+        */
+        allocator_type get_allocator() const
+        {
+            return this->data_.get_allocator();
+        }
+
         // Размер
         /** @brief Размерность
         @return Текущая размерность данного вектора
@@ -153,6 +257,31 @@ inline namespace v0
         }
         //@}
 
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        T const & element(dimension_type index) const
+        {
+            return this->data_[index];
+        }
+
+        //@{
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент, элементы вектора расположены в памяти непрерывно
+        */
+        T * data()
+        {
+            return this->data_.data();
+        }
+
+        T const * data() const
+        {
+            return this->data_.data();
+        }
+        //@}
+
         // Операторы составного присваивания
         /** @brief Умножение на скаляр
         @param a числовой множитель
@@ -161,10 +290,7 @@ inline namespace v0
         */
         math_vector & operator*=(T const & a)
         {
-            for(auto & x : *this)
-            {
-                x *= a;
-            }
+            simd::multiply(this->data_.data(), a, this->data_.size());
 
             return *this;
         }
@@ -178,10 +304,7 @@ inline namespace v0
         {
             checking_policy::check_divisor_is_not_zero(a);
 
-            for(auto & x : *this)
-            {
-                x /= a;
-            }
+            simd::divide(this->data_.data(), a, this->data_.size());
 
             return *this;
         }
@@ -196,10 +319,7 @@ inline namespace v0
         {
             checking_policy::check_equal_dimensions(*this, x);
 
-            for(auto i = 0*x.dim(); i != x.dim(); ++ i)
-            {
-                (*this)[i] += x[i];
-            }
+            simd::add(this->data_.data(), x.data_.data(), this->data_.size());
 
             return *this;
         }
@@ -214,9 +334,52 @@ inline namespace v0
         {
             checking_policy::check_equal_dimensions(*this, x);
 
-            for(auto i = 0*x.dim(); i != x.dim(); ++ i)
+            simd::subtract(this->data_.data(), x.data_.data(), this->data_.size());
+
+            return *this;
+        }
+
+        /** @brief Прибавление векторного выражения
+        @param x векторное выражение
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post Прибавляет к каждому элементу <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+
+        Выражение вычисляется за один проход вместе с прибавлением.
+        */
+        template <class E>
+        math_vector & operator+=(vector_expression<E> const & x)
+        {
+            auto const & expr = x.derived();
+
+            checking_policy::check_equal_dimensions(*this, expr);
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
+            {
+                this->data_[i] += expr.element(i);
+            }
+
+            return *this;
+        }
+
+        /** @brief Вычитание векторного выражения
+        @param x векторное выражение
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post Вычитает из каждого элемента <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+
+        Выражение вычисляется за один проход вместе с вычитанием.
+        */
+        template <class E>
+        math_vector & operator-=(vector_expression<E> const & x)
+        {
+            auto const & expr = x.derived();
+
+            checking_policy::check_equal_dimensions(*this, expr);
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
             {
-                (*this)[i] -= x[i];
+                this->data_[i] -= expr.element(i);
             }
 
             return *this;
@@ -257,100 +420,25 @@ inline namespace v0
         Data data_;
     };
 
-    /** @brief Оператор "равно"
-    @param x, y аргументы
-    @return @c true, если равны размерности векторов и все их соответствующие элементы, иначе
-    --- @b false.
-    */
-    template <class T, class Check>
-    bool operator==(math_vector<T, Check> const & x, math_vector<T, Check> const & y)
-    {
-        return std::equal(x.begin(), x.end(), y.begin(), y.end());
-    }
-
-    /** @brief Оператор "не равно"
-    @param x, y аргументы
-    @return <tt> !(x == y) </tt>
-    */
-    template <class T, class Check>
-    bool operator!=(math_vector<T, Check> const & x, math_vector<T, Check> const & y)
-    {
-        return !(x == y);
-    }
-
-    /** @brief Оператор умножения вектора на скаляр
-    @param x вектор
-    @param a скаляр
-    @return Вектор, элементы которого имеют вид <tt> x[i] * a </tt>, где
-    <tt> 0 <= i && i < x.dim() </tt>
-    */
-    template <class T1, class Check, class T2>
-    auto operator*(math_vector<T1, Check> x, T2 const & a)
-    -> math_vector<decltype(x[0]*a)>
-    {
-        auto result = math_vector<decltype(x[0]*a), Check>(std::move(x));
-        result *= a;
-        return result;
-    }
-
-    /** @brief Оператор умножения вектора на скаляр
-    @param x вектор
-    @param a скаляр
-    @return Вектор, элементы которого имеют вид <tt> a * x[i] </tt>, где
-    <tt> 0 <= i && i < x.dim() </tt>
+    /** @brief Вектор, элементы которого хранятся в памяти, выравненной по границе кэш-линии
+    @tparam T тип элементов
+    @tparam Checking стратегия проверок и обработки ошибок
     */
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator*(T const & a, math_vector<T, Check> x)
-    {
-        for(auto & elem : x)
-        {
-            elem = a * elem;
-        }
-
-        return x;
-    }
+    template <class T, class Checking = vector_policy_throws>
+    using aligned_math_vector = math_vector<T, Checking, aligned_allocator<T>>;
 
-    /** @brief Оператор сложения векторов
-    @param x, y аргументы
-    @pre <tt> x.dim() == y.dim() </tt>
-    @return Вектор, элементы которого равны сумме соответствующих элементов векторов @c x и @c y
-    */
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator+(math_vector<T, Check> x, math_vector<T, Check> const & y)
-    {
-        x += y;
-        return x;
-    }
-
-    /** @brief Оператор деления вектора на скалря
-    @param x вектор
-    @param a скаляр
-    @post <tt> a != 0 </tt>
-    @return Вектор, элементы которого равны соответствующим элементам @c x, делённым на @c a
-    */
-    template <class T1, class Check, class T2>
-    auto operator/(math_vector<T1, Check> x, T2 const & a)
-    -> math_vector<decltype(x[0] / a), Check>
-    {
-        auto result = math_vector<decltype(x[0] / a), Check>(std::move(x));
-        result /= a;
-        return result;
-    }
-
-    /** @brief Оператор разности векторов
-    @param x, y аргументы
-    @pre <tt> x.dim() == y.dim() </tt>
-    @return Вектор, элементы которого равны разности соответствующих элементов векторов @c x и @c y
+#if __cplusplus >= 201703L
+namespace pmr
+{
+    /** @brief Вектор, использующий полиморфный распределитель памяти
+    @tparam T тип элементов
+    @tparam Checking стратегия проверок и обработки ошибок
     */
-    template <class T, class Check>
-    math_vector<T, Check>
-    operator-(math_vector<T, Check> x, math_vector<T, Check> const & y)
-    {
-        x -= y;
-        return x;
-    }
+    template <class T, class Checking = vector_policy_throws>
+    using math_vector = ::grabin::math_vector<T, Checking, std::pmr::polymorphic_allocator<T>>;
+}
+// namespace pmr
+#endif
 }
 // namespace v0
 }
@@ -0,0 +1,838 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_MATH_VECTOR_VIEW_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_MATH_VECTOR_VIEW_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/math_vector_view.hpp
+ @brief Представления (невладеющие ссылки) для векторов, хранящихся во внешних буферах
+
+ Кроме представлений непрерывных массивов, определены представления для элементов,
+ расположенных с постоянным шагом, и для элементов с заданными индексами (выборка столбцов из
+ записей, хранящихся по строкам).
+*/
+
+#include <grabin/linear_algebra/math_vector.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Базовый класс представлений, определяющий операторы составного присваивания и
+    итераторы через функции-члены @c dim и @c element наследника
+    @tparam Derived тип представления-наследника
+    @tparam T тип элементов, для представлений только для чтения --- константный
+    @tparam Iterator тип итератора
+
+    Если у наследника есть функция-член @c data, то элементы считаются расположенными в памяти
+    непрерывно: тогда умножение и деление выполняются функциями из @c simd, а итератором служит
+    указатель. Если, кроме того, функция-член @c data есть у прибавляемого или вычитаемого
+    выражения, то сложение и вычитание также выполняются функциями из @c simd.
+    */
+    template <class Derived, class T, class Iterator>
+    class vector_view_base
+     : public vector_expression<Derived>
+    {
+    public:
+        // Операторы составного присваивания
+        /** @brief Умножение на скаляр
+        @param a числовой множитель
+        @return <tt> *this </tt>
+        @post Умножает каждый элемент <tt> *this </tt> на @c a
+        */
+        Derived & operator*=(std::remove_const_t<T> const & a)
+        {
+            this->multiply(a, 0);
+
+            return this->self();
+        }
+
+        /** @brief Деление на скаляр
+        @param a числовой множитель
+        @return <tt> *this </tt>
+        @post Делит каждый элемент <tt> *this </tt> на @c a
+        */
+        Derived & operator/=(std::remove_const_t<T> const & a)
+        {
+            Derived::checking_policy::check_divisor_is_not_zero(a);
+
+            this->divide(a, 0);
+
+            return this->self();
+        }
+
+        /** @brief Прибавление векторного выражения
+        @param x векторное выражение
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post Прибавляет к каждому элементу <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+        */
+        template <class E>
+        Derived & operator+=(vector_expression<E> const & x)
+        {
+            auto const & view = this->derived();
+            auto const & expr = x.derived();
+
+            Derived::checking_policy::check_equal_dimensions(view, expr);
+
+            this->add(expr, 0);
+
+            return this->self();
+        }
+
+        /** @brief Вычитание векторного выражения
+        @param x векторное выражение
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post Вычитает из каждого элемента <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+        */
+        template <class E>
+        Derived & operator-=(vector_expression<E> const & x)
+        {
+            auto const & view = this->derived();
+            auto const & expr = x.derived();
+
+            Derived::checking_policy::check_equal_dimensions(view, expr);
+
+            this->subtract(expr, 0);
+
+            return this->self();
+        }
+
+        // Итераторы
+        /** @brief Итератор начала последовательности элементов
+        @return Итератор, задающий начало последовательности элементов
+        */
+        Iterator begin() const
+        {
+            return this->make_iterator(0, 0);
+        }
+
+        /** @brief Итератор конца последовательности элементов
+        @return Итератор, задающий конец последовательности элементов
+        */
+        Iterator end() const
+        {
+            return this->make_iterator(this->derived().dim(), 0);
+        }
+
+    protected:
+        ~vector_view_base() = default;
+
+    private:
+        Derived & self()
+        {
+            return static_cast<Derived &>(*this);
+        }
+
+        template <class D = Derived>
+        auto multiply(std::remove_const_t<T> const & a, int)
+        -> decltype(std::declval<D const &>().data(), void())
+        {
+            simd::multiply(this->derived().data(), a, this->derived().dim());
+        }
+
+        void multiply(std::remove_const_t<T> const & a, long)
+        {
+            auto const & view = this->derived();
+
+            for(auto i = 0*view.dim(); i != view.dim(); ++ i)
+            {
+                view.element(i) *= a;
+            }
+        }
+
+        template <class D = Derived>
+        auto divide(std::remove_const_t<T> const & a, int)
+        -> decltype(std::declval<D const &>().data(), void())
+        {
+            simd::divide(this->derived().data(), a, this->derived().dim());
+        }
+
+        void divide(std::remove_const_t<T> const & a, long)
+        {
+            auto const & view = this->derived();
+
+            for(auto i = 0*view.dim(); i != view.dim(); ++ i)
+            {
+                view.element(i) /= a;
+            }
+        }
+
+        template <class E, class D = Derived>
+        auto add(E const & expr, int)
+        -> decltype(simd::add(std::declval<D const &>().data(), expr.data(), std::size_t{}))
+        {
+            simd::add(this->derived().data(), expr.data(), expr.dim());
+        }
+
+        template <class E>
+        void add(E const & expr, long)
+        {
+            auto const & view = this->derived();
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
+            {
+                view.element(i) += expr.element(i);
+            }
+        }
+
+        template <class E, class D = Derived>
+        auto subtract(E const & expr, int)
+        -> decltype(simd::subtract(std::declval<D const &>().data(), expr.data(), std::size_t{}))
+        {
+            simd::subtract(this->derived().data(), expr.data(), expr.dim());
+        }
+
+        template <class E>
+        void subtract(E const & expr, long)
+        {
+            auto const & view = this->derived();
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
+            {
+                view.element(i) -= expr.element(i);
+            }
+        }
+
+        template <class Index, class D = Derived>
+        auto make_iterator(Index index, int) const
+        -> decltype(Iterator(std::declval<D const &>().data() + index))
+        {
+            return Iterator(this->derived().data() + index);
+        }
+
+        template <class Index>
+        Iterator make_iterator(Index index, long) const
+        {
+            return Iterator(this->derived(), index);
+        }
+    };
+
+    /** @brief Невладеющее представление непрерывного массива в виде "математического" вектора
+    @tparam T тип элементов, для представлений только для чтения --- константный
+    @tparam Checking стратегия проверок и обработки ошибок
+
+    Представление хранит только указатель на первый элемент и размерность, поэтому его создание и
+    копирование не приводят к копированию элементов. Как и в случае указателей, константность
+    представления не распространяется на элементы: для доступа только для чтения следует
+    использовать <tt> math_vector_view<T const> </tt>. Время жизни буфера должно превышать время
+    жизни представления.
+    */
+    template <class T, class Checking = vector_policy_throws>
+    class math_vector_view
+     : public vector_view_base<math_vector_view<T, Checking>, T, T *>
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::remove_const_t<T>;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = Checking;
+
+        /// @brief Тип размерности и индексов
+        using dimension_type = std::ptrdiff_t;
+
+        /// @brief Тип итератора
+        using iterator = T *;
+
+        /// @brief Тип константного итератора
+        using const_iterator = T *;
+
+        // Создание, копирование, уничтожение
+        /** @brief Создаёт представление для массива
+        @param data указатель на первый элемент массива
+        @param n количество элементов
+        @pre <tt> [data; data + n) </tt> является допустимым интервалом
+        @post <tt> this->data() == data </tt>
+        @post <tt> this->dim() == n </tt>
+        */
+        math_vector_view(T * data, dimension_type n)
+         : data_(data)
+         , dim_(n)
+        {}
+
+        /** @brief Создаёт представление для вектора, элементы которого хранятся непрерывно
+        @param x вектор, например, @c math_vector или @c static_math_vector
+        @post <tt> this->data() == x.data() </tt>
+        @post <tt> this->dim() == x.dim() </tt>
+        */
+        template <class Vector,
+                  class = std::enable_if_t<std::is_convertible<decltype(std::declval<Vector &>().data()),
+                                                               T *>::value>>
+        math_vector_view(Vector & x)
+         : data_(x.data())
+         , dim_(x.dim())
+        {}
+
+        // Размер
+        /** @brief Размерность
+        @return Количество элементов, на которые ссылается представление
+        */
+        dimension_type dim() const
+        {
+            return this->dim_;
+        }
+
+        // Доступ к элементам
+        /** @brief Доступ к элементу по индексу
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        T & operator[](dimension_type index) const
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->data_[index];
+        }
+
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        T & element(dimension_type index) const
+        {
+            return this->data_[index];
+        }
+
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент
+        */
+        T * data() const
+        {
+            return this->data_;
+        }
+
+    private:
+        T * data_;
+        dimension_type dim_;
+    };
+
+    /** @brief Итератор произвольного доступа для представлений, элементы которых расположены
+    в памяти не непрерывно
+    @tparam View тип представления
+
+    Итератор хранит копию представления (указатели и размеры) и индекс текущего элемента, доступ к
+    элементам осуществляется через <tt> View::element </tt>.
+    */
+    template <class View>
+    class vector_view_iterator
+    {
+    public:
+        // Типы
+        /// @brief Категория итератора
+        using iterator_category = std::random_access_iterator_tag;
+
+        /// @brief Тип значения
+        using value_type = typename View::value_type;
+
+        /// @brief Тип расстояния
+        using difference_type = typename View::dimension_type;
+
+        /// @brief Тип ссылки
+        using reference = decltype(std::declval<View const &>().element(0));
+
+        /// @brief Тип указателя
+        using pointer = std::remove_reference_t<reference> *;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param view представление
+        @param index индекс элемента
+        */
+        vector_view_iterator(View const & view, difference_type index)
+         : view_(view)
+         , index_(index)
+        {}
+
+        // Доступ к элементам
+        /** @brief Доступ к текущему элементу
+        @return Ссылка на текущий элемент
+        */
+        reference operator*() const
+        {
+            return this->view_.element(this->index_);
+        }
+
+        /** @brief Доступ к членам текущего элемента
+        @return Указатель на текущий элемент
+        */
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        /** @brief Доступ к элементу по смещению
+        @param n смещение
+        @return <tt> *(*this + n) </tt>
+        */
+        reference operator[](difference_type n) const
+        {
+            return this->view_.element(this->index_ + n);
+        }
+
+        // Перемещение
+        /** @brief Переход к следующему элементу
+        @return <tt> *this </tt>
+        */
+        vector_view_iterator & operator++()
+        {
+            ++ this->index_;
+            return *this;
+        }
+
+        /** @brief Переход к следующему элементу
+        @return Копия значения итератора до перехода
+        */
+        vector_view_iterator operator++(int)
+        {
+            auto result = *this;
+            ++ *this;
+            return result;
+        }
+
+        /** @brief Переход к предыдущему элементу
+        @return <tt> *this </tt>
+        */
+        vector_view_iterator & operator--()
+        {
+            -- this->index_;
+            return *this;
+        }
+
+        /** @brief Переход к предыдущему элементу
+        @return Копия значения итератора до перехода
+        */
+        vector_view_iterator operator--(int)
+        {
+            auto result = *this;
+            -- *this;
+            return result;
+        }
+
+        /** @brief Перемещение на заданное количество элементов
+        @param n количество элементов
+        @return <tt> *this </tt>
+        */
+        vector_view_iterator & operator+=(difference_type n)
+        {
+            this->index_ += n;
+            return *this;
+        }
+
+        /** @brief Перемещение на заданное количество элементов в обратную сторону
+        @param n количество элементов
+        @return <tt> *this </tt>
+        */
+        vector_view_iterator & operator-=(difference_type n)
+        {
+            this->index_ -= n;
+            return *this;
+        }
+
+        /** @brief Итератор, смещённый на заданное количество элементов
+        @param i итератор
+        @param n количество элементов
+        @return Копия @c i, перемещённая на @c n элементов
+        */
+        friend vector_view_iterator operator+(vector_view_iterator i, difference_type n)
+        {
+            i += n;
+            return i;
+        }
+
+        /** @brief Итератор, смещённый на заданное количество элементов
+        @param n количество элементов
+        @param i итератор
+        @return Копия @c i, перемещённая на @c n элементов
+        */
+        friend vector_view_iterator operator+(difference_type n, vector_view_iterator i)
+        {
+            i += n;
+            return i;
+        }
+
+        /** @brief Итератор, смещённый на заданное количество элементов в обратную сторону
+        @param i итератор
+        @param n количество элементов
+        @return Копия @c i, перемещённая на <tt> -n </tt> элементов
+        */
+        friend vector_view_iterator operator-(vector_view_iterator i, difference_type n)
+        {
+            i -= n;
+            return i;
+        }
+
+        /** @brief Расстояние между итераторами
+        @param x, y итераторы одного и того же представления
+        @return Такое @c n, что <tt> y + n == x </tt>
+        */
+        friend difference_type operator-(vector_view_iterator const & x,
+                                         vector_view_iterator const & y)
+        {
+            return x.index_ - y.index_;
+        }
+
+        // Сравнение
+        //@{
+        /** @brief Сравнение итераторов одного и того же представления
+        @param x, y итераторы
+        @return Результат сравнения индексов элементов, на которые ссылаются итераторы
+        */
+        friend bool operator==(vector_view_iterator const & x, vector_view_iterator const & y)
+        {
+            return x.index_ == y.index_;
+        }
+
+        friend bool operator!=(vector_view_iterator const & x, vector_view_iterator const & y)
+        {
+            return !(x == y);
+        }
+
+        friend bool operator<(vector_view_iterator const & x, vector_view_iterator const & y)
+        {
+            return x.index_ < y.index_;
+        }
+
+        friend bool operator>(vector_view_iterator const & x, vector_view_iterator const & y)
+        {
+            return y < x;
+        }
+
+        friend bool operator<=(vector_view_iterator const & x, vector_view_iterator const & y)
+        {
+            return !(y < x);
+        }
+
+        friend bool operator>=(vector_view_iterator const & x, vector_view_iterator const & y)
+        {
+            return !(x < y);
+        }
+        //@}
+
+    private:
+        View view_;
+        difference_type index_;
+    };
+
+    /** @brief Невладеющее представление элементов массива, расположенных с постоянным шагом
+    @tparam T тип элементов, для представлений только для чтения --- константный
+    @tparam Checking стратегия проверок и обработки ошибок
+
+    Элемент с индексом @c i представления находится по адресу <tt> first + i * stride </tt>.
+    Такие представления позволяют, например, работать со столбцом матрицы, хранящейся по строкам,
+    или с полем массива структур без копирования элементов.
+    */
+    template <class T, class Checking = vector_policy_throws>
+    class strided_vector_view
+     : public vector_view_base<strided_vector_view<T, Checking>, T,
+                               vector_view_iterator<strided_vector_view<T, Checking>>>
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::remove_const_t<T>;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = Checking;
+
+        /// @brief Тип размерности и индексов
+        using dimension_type = std::ptrdiff_t;
+
+        /// @brief Тип итератора
+        using iterator = vector_view_iterator<strided_vector_view>;
+
+        /// @brief Тип константного итератора
+        using const_iterator = iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Создаёт представление для элементов массива, расположенных с постоянным шагом
+        @param first указатель на первый элемент
+        @param count количество элементов
+        @param stride шаг (расстояние между соседними элементами)
+        @pre Для любого @c i из интервала <tt> [0; count) </tt> указатель
+        <tt> first + i * stride </tt> ссылается на элемент массива
+        @post <tt> this->dim() == count </tt>
+        @post <tt> this->stride() == stride </tt>
+        */
+        strided_vector_view(T * first, dimension_type count, dimension_type stride)
+         : first_(first)
+         , dim_(count)
+         , stride_(stride)
+        {}
+
+        /** @brief Создаёт представление для элементов вектора, расположенных с постоянным шагом
+        @param x вектор, элементы которого хранятся непрерывно
+        @param start индекс первого элемента
+        @param count количество элементов
+        @param stride шаг (расстояние между соседними элементами)
+        @throw То же, что @c check_index стратегии проверок, если хотя бы один из элементов
+        представления выходит за пределы @c x
+        @post <tt> (*this)[i] </tt> ссылается на <tt> x[start + i * stride] </tt>
+        */
+        template <class Vector,
+                  class = std::enable_if_t<std::is_convertible<decltype(std::declval<Vector &>().data()),
+                                                               T *>::value>>
+        strided_vector_view(Vector & x, dimension_type start, dimension_type count,
+                            dimension_type stride = 1)
+         : first_(strided_vector_view::checked_first(x, start, count, stride))
+         , dim_(count)
+         , stride_(stride)
+        {}
+
+        // Размер
+        /** @brief Размерность
+        @return Количество элементов, на которые ссылается представление
+        */
+        dimension_type dim() const
+        {
+            return this->dim_;
+        }
+
+        /** @brief Шаг
+        @return Расстояние между соседними элементами представления в исходном массиве
+        */
+        dimension_type stride() const
+        {
+            return this->stride_;
+        }
+
+        // Доступ к элементам
+        /** @brief Доступ к элементу по индексу
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        T & operator[](dimension_type index) const
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        T & element(dimension_type index) const
+        {
+            return this->first_[index * this->stride_];
+        }
+
+    private:
+        // Указатель на первый элемент, вычисляемый только после проверки индексов
+        template <class Vector>
+        static T * checked_first(Vector & x, dimension_type start, dimension_type count,
+                                 dimension_type stride)
+        {
+            if(count > 0)
+            {
+                checking_policy::check_index(x, start);
+                checking_policy::check_index(x, start + (count - 1) * stride);
+            }
+
+            return x.data() + start;
+        }
+
+        T * first_;
+        dimension_type dim_;
+        dimension_type stride_;
+    };
+
+    /** @brief Невладеющее представление элементов массива с заданными индексами
+    @tparam T тип элементов, для представлений только для чтения --- константный
+    @tparam Checking стратегия проверок и обработки ошибок
+
+    Элемент с индексом @c i представления --- это <tt> data[indices[i]] </tt>. Массив индексов
+    не копируется, поэтому один и тот же список индексов (например, номеров интересующих столбцов)
+    можно использовать для построения представлений всех записей набора данных. Время жизни
+    массива индексов должно превышать время жизни представления.
+    */
+    template <class T, class Checking = vector_policy_throws>
+    class indexed_vector_view
+     : public vector_view_base<indexed_vector_view<T, Checking>, T,
+                               vector_view_iterator<indexed_vector_view<T, Checking>>>
+    {
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::remove_const_t<T>;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = Checking;
+
+        /// @brief Тип размерности и индексов
+        using dimension_type = std::ptrdiff_t;
+
+        /// @brief Тип итератора
+        using iterator = vector_view_iterator<indexed_vector_view>;
+
+        /// @brief Тип константного итератора
+        using const_iterator = iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Создаёт представление для элементов массива с заданными индексами
+        @param data указатель на начало массива
+        @param indices указатель на начало массива индексов
+        @param count количество индексов
+        @pre Для любого @c i из интервала <tt> [0; count) </tt> указатель
+        <tt> data + indices[i] </tt> ссылается на элемент массива
+        @post <tt> this->dim() == count </tt>
+        */
+        indexed_vector_view(T * data, dimension_type const * indices, dimension_type count)
+         : data_(data)
+         , indices_(indices)
+         , dim_(count)
+        {}
+
+        /** @brief Создаёт представление для элементов вектора с заданными индексами
+        @param x вектор, элементы которого хранятся непрерывно
+        @param indices контейнер индексов, элементы которого хранятся непрерывно
+        @pre Время жизни @c indices превышает время жизни представления: представление хранит
+        указатель на элементы контейнера, а не их копию
+        @throw То же, что @c check_index стратегии проверок, если хотя бы один из индексов
+        выходит за пределы @c x
+        @post <tt> (*this)[i] </tt> ссылается на <tt> x[indices[i]] </tt>
+        */
+        template <class Vector, class Indices,
+                  class = std::enable_if_t<std::is_convertible<decltype(std::declval<Vector &>().data()),
+                                                               T *>::value>>
+        indexed_vector_view(Vector & x, Indices const & indices)
+         : data_(x.data())
+         , indices_(indices.data())
+         , dim_(indices.size())
+        {
+            for(auto i = 0*this->dim_; i != this->dim_; ++ i)
+            {
+                checking_policy::check_index(x, this->indices_[i]);
+            }
+        }
+
+        /// @brief Создание представления с временным контейнером индексов запрещено
+        template <class Vector, class Indices,
+                  class = std::enable_if_t<!std::is_lvalue_reference<Indices>::value>>
+        indexed_vector_view(Vector & x, Indices && indices) = delete;
+
+        // Размер
+        /** @brief Размерность
+        @return Количество элементов, на которые ссылается представление
+        */
+        dimension_type dim() const
+        {
+            return this->dim_;
+        }
+
+        // Доступ к элементам
+        /** @brief Доступ к элементу по индексу
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        T & operator[](dimension_type index) const
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        T & element(dimension_type index) const
+        {
+            return this->data_[this->indices_[index]];
+        }
+
+    private:
+        T * data_;
+        dimension_type const * indices_;
+        dimension_type dim_;
+    };
+
+    /** @brief Создание представления для массива
+    @param data указатель на первый элемент массива
+    @param n количество элементов
+    @return <tt> math_vector_view<T>(data, n) </tt>
+    */
+    template <class T>
+    math_vector_view<T> make_math_vector_view(T * data, std::ptrdiff_t n)
+    {
+        return math_vector_view<T>(data, n);
+    }
+
+    /** @brief Создание представления для элементов массива, расположенных с постоянным шагом
+    @param first указатель на первый элемент
+    @param count количество элементов
+    @param stride шаг
+    @return <tt> strided_vector_view<T>(first, count, stride) </tt>
+    */
+    template <class T>
+    strided_vector_view<T>
+    make_strided_vector_view(T * first, std::ptrdiff_t count, std::ptrdiff_t stride)
+    {
+        return strided_vector_view<T>(first, count, stride);
+    }
+
+    /** @brief Создание представления для элементов массива с заданными индексами
+    @param data указатель на начало массива
+    @param indices указатель на начало массива индексов
+    @param count количество индексов
+    @return <tt> indexed_vector_view<T>(data, indices, count) </tt>
+    */
+    template <class T>
+    indexed_vector_view<T>
+    make_indexed_vector_view(T * data, std::ptrdiff_t const * indices, std::ptrdiff_t count)
+    {
+        return indexed_vector_view<T>(data, indices, count);
+    }
+
+    /** @brief Создание представления для элементов вектора с заданными индексами
+    @param x вектор, элементы которого хранятся непрерывно
+    @param indices контейнер индексов, элементы которого хранятся непрерывно
+    @pre Время жизни @c indices превышает время жизни представления
+    @return <tt> indexed_vector_view<T>(x, indices) </tt>, где @c T --- тип элементов, на которые
+    указывает <tt> x.data() </tt>
+    */
+    template <class Vector, class Indices>
+    indexed_vector_view<std::remove_pointer_t<decltype(std::declval<Vector &>().data())>>
+    make_indexed_vector_view(Vector & x, Indices const & indices)
+    {
+        using T = std::remove_pointer_t<decltype(x.data())>;
+
+        return indexed_vector_view<T>(x, indices);
+    }
+
+    /// @brief Создание представления с временным контейнером индексов запрещено
+    template <class Vector, class Indices,
+              class = std::enable_if_t<!std::is_lvalue_reference<Indices>::value>>
+    void make_indexed_vector_view(Vector & x, Indices && indices) = delete;
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_MATH_VECTOR_VIEW_HPP_INCLUDED
@@ -20,23 +20,69 @@
  @brief Внешнее произведение векторов
 */
 
+#include <grabin/linear_algebra/static_symmetric_matrix.hpp>
 #include <grabin/linear_algebra/symmetric_matrix.hpp>
 
 namespace grabin
 {
 inline namespace v0
 {
+namespace details
+{
+    template <class Vector>
+    auto vector_allocator(Vector const & x, int)
+    -> decltype(x.get_allocator())
+    {
+        return x.get_allocator();
+    }
+
+    template <class Vector>
+    std::allocator<typename Vector::value_type> vector_allocator(Vector const &, long)
+    {
+        return {};
+    }
+
+    template <class Scalar, class T>
+    Scalar outer_square_as(T const & x, long)
+    {
+        return static_cast<Scalar>(x * x);
+    }
+
+    template <class Scalar, class Vector>
+    auto outer_square_as(Vector const & x, int)
+    -> decltype(x.begin(), symmetric_matrix<Scalar, typename Vector::checking_policy>(x.dim()))
+    {
+        auto const n = x.dim();
+        auto const x_first = x.begin();
+
+        symmetric_matrix<Scalar, typename Vector::checking_policy> result(n);
+
+        for(auto i = 0*n; i < n; ++ i)
+        for(auto j = 0*i; j <= i; ++ j)
+        {
+            result(i, j) = static_cast<Scalar>(x_first[i] * x_first[j]);
+        }
+
+        return result;
+    }
+}
+// namespace details
+
     /** @brief Внешний "квадрат" -- внешнее произведения вектора самого на себя
     @param x вектор
     @return Симметричная матрица @c A такая, что <tt> A(i, j) == x[i] * x[j] </tt>
-    для любых <tt> 0 <= i, j < x.dim() </tt>
+    для любых <tt> 0 <= i, j < x.dim() </tt>. Если вектор использует распределитель памяти, то
+    матрица использует копию этого распределителя.
     */
     template <class Vector>
-    symmetric_matrix<typename Vector::value_type, typename Vector::checking_policy>
-    outer_square(Vector const & x)
+    auto outer_square(Vector const & x)
+    -> symmetric_matrix<typename Vector::value_type, typename Vector::checking_policy,
+                        decltype(details::vector_allocator(x, 0))>
     {
         auto const n = x.dim();
-        symmetric_matrix<typename Vector::value_type, typename Vector::checking_policy> result(n);
+        symmetric_matrix<typename Vector::value_type, typename Vector::checking_policy,
+                         decltype(details::vector_allocator(x, 0))>
+            result(n, details::vector_allocator(x, 0));
 
         for(auto i = 0*n; i < n; ++ i)
         for(auto j = 0*i; j <= i; ++ j)
@@ -47,6 +93,26 @@ inline namespace v0
         return result;
     }
 
+    /** @brief Внешний "квадрат" вектора фиксированной размерности
+    @param x вектор
+    @return Симметричная матрица фиксированной размерности @c A такая, что
+    <tt> A(i, j) == x[i] * x[j] </tt> для любых <tt> 0 <= i, j < N </tt>
+    */
+    template <class T, std::size_t N, class Check>
+    constexpr static_symmetric_matrix<T, N, Check>
+    outer_square(static_math_vector<T, N, Check> const & x)
+    {
+        static_symmetric_matrix<T, N, Check> result;
+
+        for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+        for(auto j = 0*i; j <= i; ++ j)
+        {
+            result(i, j) = x[i] * x[j];
+        }
+
+        return result;
+    }
+
     /** @brief Внешний "квадрат" (внешнее произведения вектора самого на себя) для арифметических
     типов (то есть для целочисленных типов и типов с плавающей точкой)
     @param x число
@@ -59,6 +125,98 @@ inline namespace v0
         return x*x;
     }
 
+    /** @brief Прибавление к симметричной матрице взвешенного внешнего "квадрата" разности векторов
+    без создания временных объектов
+    @param S симметричная матрица
+    @param x уменьшаемое
+    @param y вычитаемое
+    @param num числитель весового множителя
+    @param den знаменатель весового множителя
+    @pre <tt> S.dim() == x.dim() && x.dim() == y.dim() </tt>
+    @post <tt> S += outer_square(x - y) * num / den </tt>, причём порядок операций над элементами
+    совпадает с порядком операций в этом выражении.
+    */
+    template <class Matrix, class Vector1, class Vector2, class Num, class Den>
+    auto add_outer_square_of_difference(Matrix & S, Vector1 const & x, Vector2 const & y,
+                                        Num const & num, Den const & den)
+    -> decltype(S.begin(), void())
+    {
+        using checking_policy = typename Matrix::checking_policy;
+        checking_policy::check_equal_dimensions(x, y);
+        checking_policy::check_equal_dimensions(S, x);
+
+        auto const n = x.dim();
+        auto const x_first = x.begin();
+        auto const y_first = y.begin();
+
+        // Упакованное хранение: строки нижнего треугольника расположены последовательно
+        auto s = S.begin();
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            auto const d_i = x_first[i] - y_first[i];
+
+            for(auto j = 0*i; j <= i; ++ j, ++ s)
+            {
+                *s += d_i * (x_first[j] - y_first[j]) * num / den;
+            }
+        }
+    }
+
+    /** @brief Прибавление взвешенного "квадрата" разности для арифметических типов
+    @param S изменяемое значение
+    @param x уменьшаемое
+    @param y вычитаемое
+    @param num числитель весового множителя
+    @param den знаменатель весового множителя
+    @post <tt> S += outer_square(x - y) * num / den </tt>
+    */
+    template <class T, class T1, class T2, class Num, class Den>
+    std::enable_if_t<std::is_arithmetic<T>::value>
+    add_outer_square_of_difference(T & S, T1 const & x, T2 const & y,
+                                   Num const & num, Den const & den)
+    {
+        S += outer_square(T(x - y)) * num / den;
+    }
+
+    /** @brief Прибавление к симметричной матрице суммы внешних "квадратов" разностей векторов
+    @param S симметричная матрица
+    @param first, last интервал, задающий последовательность уменьшаемых
+    @param y вычитаемое
+    @pre Размерности @c S, @c y и всех элементов <tt> [first; last) </tt> совпадают
+    @post <tt> S += outer_square(x - y) </tt> для каждого @c x из <tt> [first; last) </tt>
+
+    Вычисления проводятся в общем типе элементов @c S и @c y, поэтому, например, матрица из
+    @c float со средним из @c double обновляется с точностью @c double.
+    */
+    template <class Matrix, class ForwardIterator, class Vector>
+    auto add_outer_squares_of_differences(Matrix & S, ForwardIterator first, ForwardIterator last,
+                                          Vector const & y)
+    -> decltype(S.begin(), void())
+    {
+        using Compute = std::common_type_t<typename Matrix::value_type,
+                                           std::decay_t<decltype(*y.begin())>>;
+
+        S.template rank_k_update<Compute>(Compute(1), first, last, y);
+    }
+
+    /** @brief Прибавление суммы "квадратов" разностей для арифметических типов
+    @param S изменяемое значение
+    @param first, last интервал, задающий последовательность уменьшаемых
+    @param y вычитаемое
+    @post <tt> S += outer_square(x - y) </tt> для каждого @c x из <tt> [first; last) </tt>
+    */
+    template <class T, class ForwardIterator, class T2>
+    std::enable_if_t<std::is_arithmetic<T>::value>
+    add_outer_squares_of_differences(T & S, ForwardIterator first, ForwardIterator last,
+                                     T2 const & y)
+    {
+        for(; first != last; ++ first)
+        {
+            S += outer_square(T(*first - y));
+        }
+    }
+
     /** @brief Стандартная тензорная алгебра
     @tparam T тип элементов векторного пространства
     */
@@ -76,9 +234,77 @@ inline namespace v0
             return outer_square(x);
         }
 
+        /** @brief Прибавление взвешенного тензорного "квадрата" разности
+        @param S изменяемый тензор
+        @param x уменьшаемое
+        @param y вычитаемое
+        @param num числитель весового множителя
+        @param den знаменатель весового множителя
+        @post <tt> S += outer_square_impl(x - y) * num / den </tt>, где вычисления проводятся
+        функцией add_outer_square_of_difference, которая может быть найдена с помощью ADL
+        */
+        template <class Tensor, class X, class Num, class Den>
+        static void add_outer_square_of_difference_impl(Tensor & S, X const & x, T const & y,
+                                                        Num const & num, Den const & den)
+        {
+            using ::grabin::add_outer_square_of_difference;
+            add_outer_square_of_difference(S, x, y, num, den);
+        }
+
+        /** @brief Прибавление суммы тензорных "квадратов" разностей
+        @param S изменяемый тензор
+        @param first, last интервал, задающий последовательность уменьшаемых
+        @param y вычитаемое
+        @post <tt> S += outer_square_impl(x - y) </tt> для каждого @c x из <tt> [first; last) </tt>,
+        где вычисления проводятся функцией add_outer_squares_of_differences, которая может быть
+        найдена с помощью ADL
+        */
+        template <class Tensor, class ForwardIterator>
+        static void add_outer_squares_of_differences_impl(Tensor & S, ForwardIterator first,
+                                                          ForwardIterator last, T const & y)
+        {
+            using ::grabin::add_outer_squares_of_differences;
+            add_outer_squares_of_differences(S, first, last, y);
+        }
+
         /// @brief Тип тензорного произведения
         using tensor_product_type = decltype(default_tensor_algebra::outer_square_impl(std::declval<T>()));
     };
+
+    /** @brief Тензорные алгебры, хранящие тензорные произведения с заданным типом элементов
+    @tparam Scalar тип элементов тензорных произведений, например, @c float
+
+    Шаблон <tt> tensor_storage<Scalar>::algebra </tt> можно передавать в накопители вместо
+    @c default_tensor_algebra, чтобы хранить, например, большие упакованные матрицы ковариаций
+    в @c float, тогда как среднее хранится в @c double. Обновления выполняются теми же функциями,
+    что и для @c default_tensor_algebra, то есть каждое приращение вычисляется в типе элементов
+    среднего и только затем округляется до @c Scalar. Тензорный "квадрат" вектора (в том числе
+    вектора фиксированной размерности) имеет тип <tt> symmetric_matrix<Scalar, Checking> </tt>.
+    */
+    template <class Scalar>
+    struct tensor_storage
+    {
+        /** @brief Тензорная алгебра
+        @tparam T тип элементов векторного пространства
+        */
+        template <class T>
+        struct algebra
+         : default_tensor_algebra<T>
+        {
+            /** @brief Тензорный "квадрат" с элементами типа @c Scalar
+            @param x вектор или число
+            @return Симметричная матрица @c A с элементами типа @c Scalar такая, что
+            <tt> A(i, j) == Scalar(x[i] * x[j]) </tt>, или <tt> Scalar(x * x) </tt> для чисел
+            */
+            static auto outer_square_impl(T const & x)
+            {
+                return details::outer_square_as<Scalar>(x, 0);
+            }
+
+            /// @brief Тип тензорного произведения
+            using tensor_product_type = decltype(algebra::outer_square_impl(std::declval<T>()));
+        };
+    };
 }
 // namespace v0
 }
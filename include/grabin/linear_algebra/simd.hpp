@@ -0,0 +1,1266 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_SIMD_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_SIMD_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/simd.hpp
+ @brief Векторизованные поэлементные операции над массивами
+
+ Для @c float и @c double на процессорах x86 используются явно векторизованные реализации на
+ основе SSE2, AVX2 и AVX-512, которые выбираются во время выполнения по результатам CPUID, так
+ что одна и та же программа использует лучший набор инструкций, доступный на конкретной машине.
+ Для остальных типов элементов (например, пользовательских числовых типов), а также на других
+ архитектурах и компиляторах используются обычные циклы.
+
+ Все реализации выполняют одни и те же операции в одном и том же порядке, поэтому их результаты
+ совпадают побитово. Это относится и к редукциям (скалярному произведению, сумме модулей): они
+ накапливают @c reduction_lanes частичных сумм, элемент с индексом @c i попадает в частичную сумму
+ <tt> i % reduction_lanes </tt>, а частичные суммы складываются попарно в фиксированном порядке,
+ так что ширина регистров влияет только на то, сколько частичных сумм обновляется за одну
+ инструкцию. Чтобы компилятор не заменял умножение со сложением на FMA (что изменило бы
+ округление), каждое произведение, как в векторных ядрах, так и в обычных циклах (функция
+ @c details::rounded_product), проходит через пустую ассемблерную вставку, скрывающую его от
+ оптимизатора.
+*/
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GRABIN_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace grabin
+{
+inline namespace v0
+{
+namespace simd
+{
+    /// @brief Наборы инструкций, для которых есть реализации операций
+    enum class instruction_set
+    {
+        /// @brief Обычные циклы без явной векторизации
+        generic,
+        /// @brief SSE2
+        sse2,
+        /// @brief AVX2
+        avx2,
+        /// @brief AVX-512F
+        avx512
+    };
+
+    /** @brief Определение наилучшего набора инструкций, поддерживаемого процессором
+    @return Наилучший набор инструкций, поддерживаемый процессором, на котором выполняется
+    программа. Результат определяется при первом вызове и сохраняется.
+    */
+    inline instruction_set supported_instruction_set()
+    {
+#ifdef GRABIN_SIMD_X86
+        static auto const result = []
+        {
+            __builtin_cpu_init();
+
+            if(__builtin_cpu_supports("avx512f"))
+            {
+                return instruction_set::avx512;
+            }
+            else if(__builtin_cpu_supports("avx2"))
+            {
+                return instruction_set::avx2;
+            }
+            else if(__builtin_cpu_supports("sse2"))
+            {
+                return instruction_set::sse2;
+            }
+            else
+            {
+                return instruction_set::generic;
+            }
+        }();
+
+        return result;
+#else
+        return instruction_set::generic;
+#endif
+    }
+
+    /** @brief Количество частичных сумм, используемых в редукциях
+    @tparam T тип элементов
+
+    Для элементов размером до 16 байт частичные суммы занимают 128 байт: это два регистра AVX-512,
+    четыре регистра AVX2 или восемь регистров SSE2, что позволяет скрыть задержку сложения.
+    */
+    template <class T>
+    struct reduction_lanes
+     : std::integral_constant<std::size_t, (sizeof(T) <= 16 && 16 % sizeof(T) == 0)
+                                           ? 128 / sizeof(T) : 1>
+    {};
+
+namespace details
+{
+    template <class T>
+    T rounded(T const & value, std::false_type)
+    {
+        return value;
+    }
+
+    template <class T>
+    T rounded(T value, std::true_type)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        // Пустая ассемблерная вставка скрывает значение от оптимизатора
+        __asm__("" : "+g"(value));
+        return value;
+#else
+        T volatile result = value;
+        return result;
+#endif
+    }
+
+    /* Произведение x * y, округлённое до своего типа: для чисел с плавающей точкой компилятор не
+    может объединить его с последующим сложением в FMA
+    */
+    template <class T1, class T2>
+    auto rounded_product(T1 const & x, T2 const & y) -> decltype(x * y)
+    {
+        using Result = decltype(x * y);
+        return details::rounded(Result(x * y), std::is_floating_point<Result>{});
+    }
+
+    struct add_op {};
+    struct subtract_op {};
+    struct multiply_op {};
+    struct divide_op {};
+
+    template <class T>
+    void apply(add_op, T & y, T const & x)
+    {
+        y += x;
+    }
+
+    template <class T>
+    void apply(subtract_op, T & y, T const & x)
+    {
+        y -= x;
+    }
+
+    template <class T>
+    void apply(multiply_op, T & y, T const & x)
+    {
+        y *= x;
+    }
+
+    template <class T>
+    void apply(divide_op, T & y, T const & x)
+    {
+        y /= x;
+    }
+
+    template <class T, std::size_t L>
+    T reduce_lanes(T (&s)[L])
+    {
+        for(auto h = L / 2; h > 0; h /= 2)
+        {
+            for(auto k = std::size_t{0}; k != h; ++ k)
+            {
+                s[k] += s[k + h];
+            }
+        }
+
+        return s[0];
+    }
+
+    /* Прибавляет слагаемые term(i) для i из [first; n) к частичным суммам s, где first кратно L:
+    слагаемое с индексом i прибавляется к s[i % L]
+    */
+    template <class T, std::size_t L, class Term>
+    void accumulate_lanes(T (&s)[L], std::size_t first, std::size_t n, Term term)
+    {
+        auto i = first;
+
+        for(; i + L <= n; i += L)
+        {
+            for(auto k = std::size_t{0}; k != L; ++ k)
+            {
+                s[k] += term(i + k);
+            }
+        }
+
+        for(auto k = std::size_t{0}; i != n; ++ i, ++ k)
+        {
+            s[k] += term(i);
+        }
+    }
+
+    /* Сумма term(i) для i из [0; n) с reduction_lanes<T> частичными суммами. Эталонный порядок
+    операций, которому следуют все векторизованные редукции.
+    */
+    template <class T, class Term>
+    T lane_sum(std::size_t n, Term term)
+    {
+        T s[reduction_lanes<T>::value];
+
+        for(auto & each : s)
+        {
+            each = T(0);
+        }
+
+        details::accumulate_lanes(s, 0, n, term);
+
+        return details::reduce_lanes(s);
+    }
+
+    struct generic_kernels
+    {
+        template <class Op, class T>
+        static void binary(T * y, T const * x, std::size_t n)
+        {
+            for(auto i = std::size_t{0}; i != n; ++ i)
+            {
+                details::apply(Op{}, y[i], x[i]);
+            }
+        }
+
+        template <class Op, class T>
+        static void scalar(T * y, T const & a, std::size_t n)
+        {
+            for(auto i = std::size_t{0}; i != n; ++ i)
+            {
+                details::apply(Op{}, y[i], a);
+            }
+        }
+
+        template <class T>
+        static void axpy(T * y, T const & a, T const * x, std::size_t n)
+        {
+            for(auto i = std::size_t{0}; i != n; ++ i)
+            {
+                y[i] += details::rounded_product(a, x[i]);
+            }
+        }
+
+        template <class T>
+        static void axpy4(T * y, T const * a, T const * const * x, std::size_t n)
+        {
+            for(auto i = std::size_t{0}; i != n; ++ i)
+            {
+                auto y_i = y[i];
+
+                for(auto r = 0; r != 4; ++ r)
+                {
+                    y_i += details::rounded_product(a[r], x[r][i]);
+                }
+
+                y[i] = y_i;
+            }
+        }
+
+        template <class T>
+        static T dot(T const * x, T const * y, std::size_t n)
+        {
+            return details::lane_sum<T>(n, [=](std::size_t i)
+            {
+                return details::rounded_product(x[i], y[i]);
+            });
+        }
+
+        template <class T>
+        static T sum_abs(T const * x, std::size_t n)
+        {
+            using std::abs;
+            return details::lane_sum<T>(n, [=](std::size_t i) { return T(abs(x[i])); });
+        }
+    };
+
+#ifdef GRABIN_SIMD_X86
+    struct sse2_kernels
+    {
+        __attribute__((target("sse2")))
+        static __m128d load(double const * p) { return _mm_loadu_pd(p); }
+
+        __attribute__((target("sse2")))
+        static __m128 load(float const * p) { return _mm_loadu_ps(p); }
+
+        __attribute__((target("sse2")))
+        static void store(double * p, __m128d x) { _mm_storeu_pd(p, x); }
+
+        __attribute__((target("sse2")))
+        static void store(float * p, __m128 x) { _mm_storeu_ps(p, x); }
+
+        __attribute__((target("sse2")))
+        static __m128d broadcast(double a) { return _mm_set1_pd(a); }
+
+        __attribute__((target("sse2")))
+        static __m128 broadcast(float a) { return _mm_set1_ps(a); }
+
+        __attribute__((target("sse2")))
+        static __m128d apply(add_op, __m128d y, __m128d x) { return _mm_add_pd(y, x); }
+
+        __attribute__((target("sse2")))
+        static __m128 apply(add_op, __m128 y, __m128 x) { return _mm_add_ps(y, x); }
+
+        __attribute__((target("sse2")))
+        static __m128d apply(subtract_op, __m128d y, __m128d x) { return _mm_sub_pd(y, x); }
+
+        __attribute__((target("sse2")))
+        static __m128 apply(subtract_op, __m128 y, __m128 x) { return _mm_sub_ps(y, x); }
+
+        __attribute__((target("sse2")))
+        static __m128d apply(multiply_op, __m128d y, __m128d x)
+        {
+            auto result = _mm_mul_pd(y, x);
+            __asm__("" : "+v"(result));
+            return result;
+        }
+
+        __attribute__((target("sse2")))
+        static __m128 apply(multiply_op, __m128 y, __m128 x)
+        {
+            auto result = _mm_mul_ps(y, x);
+            __asm__("" : "+v"(result));
+            return result;
+        }
+
+        __attribute__((target("sse2")))
+        static __m128d apply(divide_op, __m128d y, __m128d x) { return _mm_div_pd(y, x); }
+
+        __attribute__((target("sse2")))
+        static __m128 apply(divide_op, __m128 y, __m128 x) { return _mm_div_ps(y, x); }
+
+        __attribute__((target("sse2")))
+        static __m128d absolute(__m128d x) { return _mm_andnot_pd(_mm_set1_pd(-0.0), x); }
+
+        __attribute__((target("sse2")))
+        static __m128 absolute(__m128 x) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+
+        template <class Op, class T>
+        __attribute__((target("sse2")))
+        static void binary(T * y, T const * x, std::size_t n)
+        {
+            auto const width = 16 / sizeof(T);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(Op{}, load(y + i), load(x + i)));
+            }
+
+            generic_kernels::binary<Op>(y + i, x + i, n - i);
+        }
+
+        template <class Op, class T>
+        __attribute__((target("sse2")))
+        static void scalar(T * y, T const & a, std::size_t n)
+        {
+            auto const width = 16 / sizeof(T);
+            auto const a_reg = broadcast(a);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(Op{}, load(y + i), a_reg));
+            }
+
+            generic_kernels::scalar<Op>(y + i, a, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("sse2")))
+        static void axpy(T * y, T const & a, T const * x, std::size_t n)
+        {
+            auto const width = 16 / sizeof(T);
+            auto const a_reg = broadcast(a);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(add_op{}, load(y + i), apply(multiply_op{}, a_reg, load(x + i))));
+            }
+
+            generic_kernels::axpy(y + i, a, x + i, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("sse2")))
+        static void axpy4(T * y, T const * a, T const * const * x, std::size_t n)
+        {
+            auto const width = 16 / sizeof(T);
+            decltype(broadcast(a[0])) a_reg[4];
+
+            for(auto r = 0; r != 4; ++ r)
+            {
+                a_reg[r] = broadcast(a[r]);
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                auto y_reg = load(y + i);
+
+                for(auto r = 0; r != 4; ++ r)
+                {
+                    y_reg = apply(add_op{}, y_reg, apply(multiply_op{}, a_reg[r], load(x[r] + i)));
+                }
+
+                store(y + i, y_reg);
+            }
+
+            T const * const tail[4] = {x[0] + i, x[1] + i, x[2] + i, x[3] + i};
+            generic_kernels::axpy4(y + i, a, tail, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("sse2")))
+        static T dot(T const * x, T const * y, std::size_t n)
+        {
+            constexpr auto width = 16 / sizeof(T);
+            constexpr auto lanes = reduction_lanes<T>::value;
+            constexpr auto regs = lanes / width;
+
+            decltype(broadcast(T(0))) acc[regs];
+
+            for(auto & each : acc)
+            {
+                each = broadcast(T(0));
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + lanes <= n; i += lanes)
+            {
+                for(auto r = std::size_t{0}; r != regs; ++ r)
+                {
+                    auto const product = apply(multiply_op{}, load(x + i + r * width),
+                                               load(y + i + r * width));
+                    acc[r] = apply(add_op{}, acc[r], product);
+                }
+            }
+
+            T s[lanes];
+
+            for(auto r = std::size_t{0}; r != regs; ++ r)
+            {
+                store(s + r * width, acc[r]);
+            }
+
+            details::accumulate_lanes(s, i, n, [=](std::size_t j)
+            {
+                return details::rounded_product(x[j], y[j]);
+            });
+
+            return details::reduce_lanes(s);
+        }
+
+        template <class T>
+        __attribute__((target("sse2")))
+        static T sum_abs(T const * x, std::size_t n)
+        {
+            constexpr auto width = 16 / sizeof(T);
+            constexpr auto lanes = reduction_lanes<T>::value;
+            constexpr auto regs = lanes / width;
+
+            decltype(broadcast(T(0))) acc[regs];
+
+            for(auto & each : acc)
+            {
+                each = broadcast(T(0));
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + lanes <= n; i += lanes)
+            {
+                for(auto r = std::size_t{0}; r != regs; ++ r)
+                {
+                    acc[r] = apply(add_op{}, acc[r], absolute(load(x + i + r * width)));
+                }
+            }
+
+            T s[lanes];
+
+            for(auto r = std::size_t{0}; r != regs; ++ r)
+            {
+                store(s + r * width, acc[r]);
+            }
+
+            details::accumulate_lanes(s, i, n, [=](std::size_t j) { return std::abs(x[j]); });
+
+            return details::reduce_lanes(s);
+        }
+    };
+
+    struct avx2_kernels
+    {
+        __attribute__((target("avx2")))
+        static __m256d load(double const * p) { return _mm256_loadu_pd(p); }
+
+        __attribute__((target("avx2")))
+        static __m256 load(float const * p) { return _mm256_loadu_ps(p); }
+
+        __attribute__((target("avx2")))
+        static void store(double * p, __m256d x) { _mm256_storeu_pd(p, x); }
+
+        __attribute__((target("avx2")))
+        static void store(float * p, __m256 x) { _mm256_storeu_ps(p, x); }
+
+        __attribute__((target("avx2")))
+        static __m256d broadcast(double a) { return _mm256_set1_pd(a); }
+
+        __attribute__((target("avx2")))
+        static __m256 broadcast(float a) { return _mm256_set1_ps(a); }
+
+        __attribute__((target("avx2")))
+        static __m256d apply(add_op, __m256d y, __m256d x) { return _mm256_add_pd(y, x); }
+
+        __attribute__((target("avx2")))
+        static __m256 apply(add_op, __m256 y, __m256 x) { return _mm256_add_ps(y, x); }
+
+        __attribute__((target("avx2")))
+        static __m256d apply(subtract_op, __m256d y, __m256d x) { return _mm256_sub_pd(y, x); }
+
+        __attribute__((target("avx2")))
+        static __m256 apply(subtract_op, __m256 y, __m256 x) { return _mm256_sub_ps(y, x); }
+
+        __attribute__((target("avx2")))
+        static __m256d apply(multiply_op, __m256d y, __m256d x)
+        {
+            auto result = _mm256_mul_pd(y, x);
+            __asm__("" : "+v"(result));
+            return result;
+        }
+
+        __attribute__((target("avx2")))
+        static __m256 apply(multiply_op, __m256 y, __m256 x)
+        {
+            auto result = _mm256_mul_ps(y, x);
+            __asm__("" : "+v"(result));
+            return result;
+        }
+
+        __attribute__((target("avx2")))
+        static __m256d apply(divide_op, __m256d y, __m256d x) { return _mm256_div_pd(y, x); }
+
+        __attribute__((target("avx2")))
+        static __m256 apply(divide_op, __m256 y, __m256 x) { return _mm256_div_ps(y, x); }
+
+        __attribute__((target("avx2")))
+        static __m256d absolute(__m256d x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+
+        __attribute__((target("avx2")))
+        static __m256 absolute(__m256 x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+
+        template <class Op, class T>
+        __attribute__((target("avx2")))
+        static void binary(T * y, T const * x, std::size_t n)
+        {
+            auto const width = 32 / sizeof(T);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(Op{}, load(y + i), load(x + i)));
+            }
+
+            generic_kernels::binary<Op>(y + i, x + i, n - i);
+        }
+
+        template <class Op, class T>
+        __attribute__((target("avx2")))
+        static void scalar(T * y, T const & a, std::size_t n)
+        {
+            auto const width = 32 / sizeof(T);
+            auto const a_reg = broadcast(a);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(Op{}, load(y + i), a_reg));
+            }
+
+            generic_kernels::scalar<Op>(y + i, a, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("avx2")))
+        static void axpy(T * y, T const & a, T const * x, std::size_t n)
+        {
+            auto const width = 32 / sizeof(T);
+            auto const a_reg = broadcast(a);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(add_op{}, load(y + i), apply(multiply_op{}, a_reg, load(x + i))));
+            }
+
+            generic_kernels::axpy(y + i, a, x + i, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("avx2")))
+        static void axpy4(T * y, T const * a, T const * const * x, std::size_t n)
+        {
+            auto const width = 32 / sizeof(T);
+            decltype(broadcast(a[0])) a_reg[4];
+
+            for(auto r = 0; r != 4; ++ r)
+            {
+                a_reg[r] = broadcast(a[r]);
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                auto y_reg = load(y + i);
+
+                for(auto r = 0; r != 4; ++ r)
+                {
+                    y_reg = apply(add_op{}, y_reg, apply(multiply_op{}, a_reg[r], load(x[r] + i)));
+                }
+
+                store(y + i, y_reg);
+            }
+
+            T const * const tail[4] = {x[0] + i, x[1] + i, x[2] + i, x[3] + i};
+            generic_kernels::axpy4(y + i, a, tail, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("avx2")))
+        static T dot(T const * x, T const * y, std::size_t n)
+        {
+            constexpr auto width = 32 / sizeof(T);
+            constexpr auto lanes = reduction_lanes<T>::value;
+            constexpr auto regs = lanes / width;
+
+            decltype(broadcast(T(0))) acc[regs];
+
+            for(auto & each : acc)
+            {
+                each = broadcast(T(0));
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + lanes <= n; i += lanes)
+            {
+                for(auto r = std::size_t{0}; r != regs; ++ r)
+                {
+                    auto const product = apply(multiply_op{}, load(x + i + r * width),
+                                               load(y + i + r * width));
+                    acc[r] = apply(add_op{}, acc[r], product);
+                }
+            }
+
+            T s[lanes];
+
+            for(auto r = std::size_t{0}; r != regs; ++ r)
+            {
+                store(s + r * width, acc[r]);
+            }
+
+            details::accumulate_lanes(s, i, n, [=](std::size_t j)
+            {
+                return details::rounded_product(x[j], y[j]);
+            });
+
+            return details::reduce_lanes(s);
+        }
+
+        template <class T>
+        __attribute__((target("avx2")))
+        static T sum_abs(T const * x, std::size_t n)
+        {
+            constexpr auto width = 32 / sizeof(T);
+            constexpr auto lanes = reduction_lanes<T>::value;
+            constexpr auto regs = lanes / width;
+
+            decltype(broadcast(T(0))) acc[regs];
+
+            for(auto & each : acc)
+            {
+                each = broadcast(T(0));
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + lanes <= n; i += lanes)
+            {
+                for(auto r = std::size_t{0}; r != regs; ++ r)
+                {
+                    acc[r] = apply(add_op{}, acc[r], absolute(load(x + i + r * width)));
+                }
+            }
+
+            T s[lanes];
+
+            for(auto r = std::size_t{0}; r != regs; ++ r)
+            {
+                store(s + r * width, acc[r]);
+            }
+
+            details::accumulate_lanes(s, i, n, [=](std::size_t j) { return std::abs(x[j]); });
+
+            return details::reduce_lanes(s);
+        }
+    };
+
+    struct avx512_kernels
+    {
+        __attribute__((target("avx512f")))
+        static __m512d load(double const * p) { return _mm512_loadu_pd(p); }
+
+        __attribute__((target("avx512f")))
+        static __m512 load(float const * p) { return _mm512_loadu_ps(p); }
+
+        __attribute__((target("avx512f")))
+        static void store(double * p, __m512d x) { _mm512_storeu_pd(p, x); }
+
+        __attribute__((target("avx512f")))
+        static void store(float * p, __m512 x) { _mm512_storeu_ps(p, x); }
+
+        __attribute__((target("avx512f")))
+        static __m512d broadcast(double a) { return _mm512_set1_pd(a); }
+
+        __attribute__((target("avx512f")))
+        static __m512 broadcast(float a) { return _mm512_set1_ps(a); }
+
+        __attribute__((target("avx512f")))
+        static __m512d apply(add_op, __m512d y, __m512d x) { return _mm512_add_pd(y, x); }
+
+        __attribute__((target("avx512f")))
+        static __m512 apply(add_op, __m512 y, __m512 x) { return _mm512_add_ps(y, x); }
+
+        __attribute__((target("avx512f")))
+        static __m512d apply(subtract_op, __m512d y, __m512d x) { return _mm512_sub_pd(y, x); }
+
+        __attribute__((target("avx512f")))
+        static __m512 apply(subtract_op, __m512 y, __m512 x) { return _mm512_sub_ps(y, x); }
+
+        __attribute__((target("avx512f")))
+        static __m512d apply(multiply_op, __m512d y, __m512d x)
+        {
+            auto result = _mm512_mul_pd(y, x);
+            __asm__("" : "+v"(result));
+            return result;
+        }
+
+        __attribute__((target("avx512f")))
+        static __m512 apply(multiply_op, __m512 y, __m512 x)
+        {
+            auto result = _mm512_mul_ps(y, x);
+            __asm__("" : "+v"(result));
+            return result;
+        }
+
+        __attribute__((target("avx512f")))
+        static __m512d apply(divide_op, __m512d y, __m512d x) { return _mm512_div_pd(y, x); }
+
+        __attribute__((target("avx512f")))
+        static __m512 apply(divide_op, __m512 y, __m512 x) { return _mm512_div_ps(y, x); }
+
+        __attribute__((target("avx512f")))
+        static __m512d absolute(__m512d x)
+        {
+            auto const magnitude = _mm512_set1_epi64(0x7FFFFFFFFFFFFFFF);
+            return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x), magnitude));
+        }
+
+        __attribute__((target("avx512f")))
+        static __m512 absolute(__m512 x)
+        {
+            auto const magnitude = _mm512_set1_epi32(0x7FFFFFFF);
+            return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(x), magnitude));
+        }
+
+        template <class Op, class T>
+        __attribute__((target("avx512f")))
+        static void binary(T * y, T const * x, std::size_t n)
+        {
+            auto const width = 64 / sizeof(T);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(Op{}, load(y + i), load(x + i)));
+            }
+
+            generic_kernels::binary<Op>(y + i, x + i, n - i);
+        }
+
+        template <class Op, class T>
+        __attribute__((target("avx512f")))
+        static void scalar(T * y, T const & a, std::size_t n)
+        {
+            auto const width = 64 / sizeof(T);
+            auto const a_reg = broadcast(a);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(Op{}, load(y + i), a_reg));
+            }
+
+            generic_kernels::scalar<Op>(y + i, a, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("avx512f")))
+        static void axpy(T * y, T const & a, T const * x, std::size_t n)
+        {
+            auto const width = 64 / sizeof(T);
+            auto const a_reg = broadcast(a);
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                store(y + i, apply(add_op{}, load(y + i), apply(multiply_op{}, a_reg, load(x + i))));
+            }
+
+            generic_kernels::axpy(y + i, a, x + i, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("avx512f")))
+        static void axpy4(T * y, T const * a, T const * const * x, std::size_t n)
+        {
+            auto const width = 64 / sizeof(T);
+            decltype(broadcast(a[0])) a_reg[4];
+
+            for(auto r = 0; r != 4; ++ r)
+            {
+                a_reg[r] = broadcast(a[r]);
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + width <= n; i += width)
+            {
+                auto y_reg = load(y + i);
+
+                for(auto r = 0; r != 4; ++ r)
+                {
+                    y_reg = apply(add_op{}, y_reg, apply(multiply_op{}, a_reg[r], load(x[r] + i)));
+                }
+
+                store(y + i, y_reg);
+            }
+
+            T const * const tail[4] = {x[0] + i, x[1] + i, x[2] + i, x[3] + i};
+            generic_kernels::axpy4(y + i, a, tail, n - i);
+        }
+
+        template <class T>
+        __attribute__((target("avx512f")))
+        static T dot(T const * x, T const * y, std::size_t n)
+        {
+            constexpr auto width = 64 / sizeof(T);
+            constexpr auto lanes = reduction_lanes<T>::value;
+            constexpr auto regs = lanes / width;
+
+            decltype(broadcast(T(0))) acc[regs];
+
+            for(auto & each : acc)
+            {
+                each = broadcast(T(0));
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + lanes <= n; i += lanes)
+            {
+                for(auto r = std::size_t{0}; r != regs; ++ r)
+                {
+                    auto const product = apply(multiply_op{}, load(x + i + r * width),
+                                               load(y + i + r * width));
+                    acc[r] = apply(add_op{}, acc[r], product);
+                }
+            }
+
+            T s[lanes];
+
+            for(auto r = std::size_t{0}; r != regs; ++ r)
+            {
+                store(s + r * width, acc[r]);
+            }
+
+            details::accumulate_lanes(s, i, n, [=](std::size_t j)
+            {
+                return details::rounded_product(x[j], y[j]);
+            });
+
+            return details::reduce_lanes(s);
+        }
+
+        template <class T>
+        __attribute__((target("avx512f")))
+        static T sum_abs(T const * x, std::size_t n)
+        {
+            constexpr auto width = 64 / sizeof(T);
+            constexpr auto lanes = reduction_lanes<T>::value;
+            constexpr auto regs = lanes / width;
+
+            decltype(broadcast(T(0))) acc[regs];
+
+            for(auto & each : acc)
+            {
+                each = broadcast(T(0));
+            }
+
+            auto i = std::size_t{0};
+
+            for(; i + lanes <= n; i += lanes)
+            {
+                for(auto r = std::size_t{0}; r != regs; ++ r)
+                {
+                    acc[r] = apply(add_op{}, acc[r], absolute(load(x + i + r * width)));
+                }
+            }
+
+            T s[lanes];
+
+            for(auto r = std::size_t{0}; r != regs; ++ r)
+            {
+                store(s + r * width, acc[r]);
+            }
+
+            details::accumulate_lanes(s, i, n, [=](std::size_t j) { return std::abs(x[j]); });
+
+            return details::reduce_lanes(s);
+        }
+    };
+#endif
+// GRABIN_SIMD_X86
+
+    template <class T>
+    struct has_simd_kernels
+     : std::integral_constant<bool, std::is_same<T, float>::value || std::is_same<T, double>::value>
+    {};
+
+    template <class Op, class T>
+    std::enable_if_t<!has_simd_kernels<T>::value>
+    binary(instruction_set, T * y, T const * x, std::size_t n)
+    {
+        generic_kernels::binary<Op>(y, x, n);
+    }
+
+    template <class Op, class T>
+    std::enable_if_t<has_simd_kernels<T>::value>
+    binary(instruction_set isa, T * y, T const * x, std::size_t n)
+    {
+        switch(isa)
+        {
+#ifdef GRABIN_SIMD_X86
+        case instruction_set::avx512:
+            return avx512_kernels::binary<Op>(y, x, n);
+
+        case instruction_set::avx2:
+            return avx2_kernels::binary<Op>(y, x, n);
+
+        case instruction_set::sse2:
+            return sse2_kernels::binary<Op>(y, x, n);
+#endif
+        default:
+            return generic_kernels::binary<Op>(y, x, n);
+        }
+    }
+
+    template <class Op, class T>
+    std::enable_if_t<!has_simd_kernels<T>::value>
+    scalar(instruction_set, T * y, T const & a, std::size_t n)
+    {
+        generic_kernels::scalar<Op>(y, a, n);
+    }
+
+    template <class Op, class T>
+    std::enable_if_t<has_simd_kernels<T>::value>
+    scalar(instruction_set isa, T * y, T const & a, std::size_t n)
+    {
+        switch(isa)
+        {
+#ifdef GRABIN_SIMD_X86
+        case instruction_set::avx512:
+            return avx512_kernels::scalar<Op>(y, a, n);
+
+        case instruction_set::avx2:
+            return avx2_kernels::scalar<Op>(y, a, n);
+
+        case instruction_set::sse2:
+            return sse2_kernels::scalar<Op>(y, a, n);
+#endif
+        default:
+            return generic_kernels::scalar<Op>(y, a, n);
+        }
+    }
+
+    template <class T>
+    std::enable_if_t<!has_simd_kernels<T>::value>
+    axpy(instruction_set, T * y, T const & a, T const * x, std::size_t n)
+    {
+        generic_kernels::axpy(y, a, x, n);
+    }
+
+    template <class T>
+    std::enable_if_t<has_simd_kernels<T>::value>
+    axpy(instruction_set isa, T * y, T const & a, T const * x, std::size_t n)
+    {
+        switch(isa)
+        {
+#ifdef GRABIN_SIMD_X86
+        case instruction_set::avx512:
+            return avx512_kernels::axpy(y, a, x, n);
+
+        case instruction_set::avx2:
+            return avx2_kernels::axpy(y, a, x, n);
+
+        case instruction_set::sse2:
+            return sse2_kernels::axpy(y, a, x, n);
+#endif
+        default:
+            return generic_kernels::axpy(y, a, x, n);
+        }
+    }
+
+    template <class T>
+    std::enable_if_t<!has_simd_kernels<T>::value>
+    axpy4(instruction_set, T * y, T const * a, T const * const * x, std::size_t n)
+    {
+        generic_kernels::axpy4(y, a, x, n);
+    }
+
+    template <class T>
+    std::enable_if_t<has_simd_kernels<T>::value>
+    axpy4(instruction_set isa, T * y, T const * a, T const * const * x, std::size_t n)
+    {
+        switch(isa)
+        {
+#ifdef GRABIN_SIMD_X86
+        case instruction_set::avx512:
+            return avx512_kernels::axpy4(y, a, x, n);
+
+        case instruction_set::avx2:
+            return avx2_kernels::axpy4(y, a, x, n);
+
+        case instruction_set::sse2:
+            return sse2_kernels::axpy4(y, a, x, n);
+#endif
+        default:
+            return generic_kernels::axpy4(y, a, x, n);
+        }
+    }
+
+    template <class T>
+    std::enable_if_t<!has_simd_kernels<T>::value, T>
+    dot(instruction_set, T const * x, T const * y, std::size_t n)
+    {
+        return generic_kernels::dot(x, y, n);
+    }
+
+    template <class T>
+    std::enable_if_t<has_simd_kernels<T>::value, T>
+    dot(instruction_set isa, T const * x, T const * y, std::size_t n)
+    {
+        switch(isa)
+        {
+#ifdef GRABIN_SIMD_X86
+        case instruction_set::avx512:
+            return avx512_kernels::dot(x, y, n);
+
+        case instruction_set::avx2:
+            return avx2_kernels::dot(x, y, n);
+
+        case instruction_set::sse2:
+            return sse2_kernels::dot(x, y, n);
+#endif
+        default:
+            return generic_kernels::dot(x, y, n);
+        }
+    }
+
+    template <class T>
+    std::enable_if_t<!has_simd_kernels<T>::value, T>
+    sum_abs(instruction_set, T const * x, std::size_t n)
+    {
+        return generic_kernels::sum_abs(x, n);
+    }
+
+    template <class T>
+    std::enable_if_t<has_simd_kernels<T>::value, T>
+    sum_abs(instruction_set isa, T const * x, std::size_t n)
+    {
+        switch(isa)
+        {
+#ifdef GRABIN_SIMD_X86
+        case instruction_set::avx512:
+            return avx512_kernels::sum_abs(x, n);
+
+        case instruction_set::avx2:
+            return avx2_kernels::sum_abs(x, n);
+
+        case instruction_set::sse2:
+            return sse2_kernels::sum_abs(x, n);
+#endif
+        default:
+            return generic_kernels::sum_abs(x, n);
+        }
+    }
+}
+// namespace details
+
+    /** @brief Поэлементное прибавление массива
+    @param y указатель на начало изменяемого массива
+    @param x указатель на начало прибавляемого массива
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @post <tt> y[i] += x[i] </tt> для всех @c i из <tt> [0; n) </tt>
+    */
+    template <class T>
+    void add(T * y, T const * x, std::size_t n, instruction_set isa = supported_instruction_set())
+    {
+        details::binary<details::add_op>(isa, y, x, n);
+    }
+
+    /** @brief Поэлементное вычитание массива
+    @param y указатель на начало изменяемого массива
+    @param x указатель на начало вычитаемого массива
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @post <tt> y[i] -= x[i] </tt> для всех @c i из <tt> [0; n) </tt>
+    */
+    template <class T>
+    void subtract(T * y, T const * x, std::size_t n,
+                  instruction_set isa = supported_instruction_set())
+    {
+        details::binary<details::subtract_op>(isa, y, x, n);
+    }
+
+    /** @brief Умножение элементов массива на скаляр
+    @param y указатель на начало изменяемого массива
+    @param a множитель
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @post <tt> y[i] *= a </tt> для всех @c i из <tt> [0; n) </tt>
+    */
+    template <class T>
+    void multiply(T * y, T const & a, std::size_t n,
+                  instruction_set isa = supported_instruction_set())
+    {
+        details::scalar<details::multiply_op>(isa, y, a, n);
+    }
+
+    /** @brief Деление элементов массива на скаляр
+    @param y указатель на начало изменяемого массива
+    @param a делитель
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @post <tt> y[i] /= a </tt> для всех @c i из <tt> [0; n) </tt>
+    */
+    template <class T>
+    void divide(T * y, T const & a, std::size_t n,
+                instruction_set isa = supported_instruction_set())
+    {
+        details::scalar<details::divide_op>(isa, y, a, n);
+    }
+
+    /** @brief Прибавление массива, умноженного на скаляр
+    @param y указатель на начало изменяемого массива
+    @param a множитель
+    @param x указатель на начало прибавляемого массива
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @post <tt> y[i] += a * x[i] </tt> для всех @c i из <tt> [0; n) </tt>
+    */
+    template <class T>
+    void axpy(T * y, T const & a, T const * x, std::size_t n,
+              instruction_set isa = supported_instruction_set())
+    {
+        details::axpy(isa, y, a, x, n);
+    }
+
+    /** @brief Прибавление четырёх массивов, умноженных на скаляры
+    @param y указатель на начало изменяемого массива
+    @param a указатель на массив из четырёх множителей
+    @param x указатель на массив из четырёх указателей на начала прибавляемых массивов
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @post <tt> y[i] += a[0] * x[0][i] </tt>, затем <tt> y[i] += a[1] * x[1][i] </tt> и так
+    далее для всех @c i из <tt> [0; n) </tt>, то есть результат совпадает с результатом четырёх
+    последовательных вызовов @c axpy, но каждый элемент @c y загружается и сохраняется один раз.
+    */
+    template <class T>
+    void axpy4(T * y, T const * a, T const * const * x, std::size_t n,
+               instruction_set isa = supported_instruction_set())
+    {
+        details::axpy4(isa, y, a, x, n);
+    }
+
+    /** @brief Скалярное произведение массивов
+    @param x указатель на начало первого массива
+    @param y указатель на начало второго массива
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @return Сумма <tt> x[i] * y[i] </tt> для всех @c i из <tt> [0; n) </tt>, вычисленная с
+    <tt> reduction_lanes<T>::value </tt> частичными суммами. Результат не зависит от @c isa.
+    */
+    template <class T>
+    T dot(T const * x, T const * y, std::size_t n,
+          instruction_set isa = supported_instruction_set())
+    {
+        return details::dot(isa, x, y, n);
+    }
+
+    /** @brief Сумма модулей элементов массива
+    @param x указатель на начало массива
+    @param n количество элементов
+    @param isa используемый набор инструкций
+    @pre Процессор поддерживает набор инструкций @c isa
+    @return Сумма <tt> abs(x[i]) </tt> для всех @c i из <tt> [0; n) </tt>, вычисленная с
+    <tt> reduction_lanes<T>::value </tt> частичными суммами. Результат не зависит от @c isa.
+    */
+    template <class T>
+    T sum_abs(T const * x, std::size_t n, instruction_set isa = supported_instruction_set())
+    {
+        return details::sum_abs(isa, x, n);
+    }
+}
+// namespace simd
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_SIMD_HPP_INCLUDED
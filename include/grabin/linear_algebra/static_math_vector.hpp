@@ -0,0 +1,419 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_STATIC_MATH_VECTOR_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_STATIC_MATH_VECTOR_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/static_math_vector.hpp
+ @brief Векторы, размерность которых известна на этапе компиляции
+
+ Элементы хранятся непосредственно в объекте, поэтому создание и копирование таких векторов не
+ требует выделения динамической памяти, а циклы по элементам могут быть полностью развёрнуты
+ компилятором. Все операции объявлены как @c constexpr.
+*/
+
+#include <grabin/linear_algebra/math_vector.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Класс "математического" вектора фиксированной размерности
+    @tparam T тип элементов
+    @tparam N размерность
+    @tparam Checking стратегия проверок и обработки ошибок
+    */
+    template <class T, std::size_t N, class Checking = vector_policy_throws>
+    class static_math_vector
+     : public vector_expression<static_math_vector<T, N, Checking>>
+    {
+        static_assert(N > 0, "Dimension must be positive");
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = Checking;
+
+        /// @brief Тип размерности и индексов
+        using dimension_type = std::ptrdiff_t;
+
+        /// @brief Тип итератора
+        using iterator = T *;
+
+        /// @brief Тип константного итератора
+        using const_iterator = T const *;
+
+        // Создание, копирование, уничтожение
+        /** @brief Создаёт нулевой вектор
+        @post Для любого @c i из интервала <tt> [0; N) </tt> выполняется
+        <tt> (*this)[i] == T(0) </tt>
+        */
+        constexpr static_math_vector()
+         : data_{}
+        {}
+
+        /** @brief Создаёт вектор, все элементы которого равны заданному значению
+        @param value значение элементов
+        @post Для любого @c i из интервала <tt> [0; N) </tt> выполняется
+        <tt> (*this)[i] == value </tt>
+
+        В отличие от @c math_vector, аргумент этого конструктора задаёт значение элементов, а не
+        размерность. Благодаря этому выражения вида <tt> Vector(0) </tt>, используемые
+        накопителями для получения "нулевого" элемента, имеют правильный смысл.
+        */
+        constexpr explicit static_math_vector(T const & value)
+         : data_{}
+        {
+            for(auto & x : this->data_)
+            {
+                x = value;
+            }
+        }
+
+        /** @brief Создаёт вектор с элементами из списка инициализации
+        @param init список элементов
+        @pre <tt> init.size() == N </tt>
+        @throw logic_error, если <tt> init.size() != N </tt>
+        @post Для любого @c i из интервала <tt> [0; N) </tt> выполняется
+        <tt> (*this)[i] == *(init.begin() + i) </tt>
+        */
+        constexpr static_math_vector(std::initializer_list<T> init)
+         : data_{}
+        {
+            if(init.size() != N)
+            {
+                throw std::logic_error("incompatible dimensions");
+            }
+
+            auto pos = init.begin();
+
+            for(auto & x : this->data_)
+            {
+                x = *pos;
+                ++ pos;
+            }
+        }
+
+        // Размер
+        /** @brief Размерность
+        @return @c N
+        */
+        constexpr dimension_type dim() const
+        {
+            return N;
+        }
+
+        // Доступ к элементам
+        //@{
+        /** @brief Доступ к элементу по индексу
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        constexpr T const & operator[](dimension_type index) const
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->data_[index];
+        }
+
+        constexpr T & operator[](dimension_type index)
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->data_[index];
+        }
+        //@}
+
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Ссылка на элемент с индексом @c index
+        */
+        constexpr T const & element(dimension_type index) const
+        {
+            return this->data_[index];
+        }
+
+        //@{
+        /** @brief Доступ к непрерывному массиву элементов
+        @return Указатель на первый элемент, элементы вектора расположены в памяти непрерывно
+        */
+        constexpr T * data()
+        {
+            return this->data_;
+        }
+
+        constexpr T const * data() const
+        {
+            return this->data_;
+        }
+        //@}
+
+        // Операторы составного присваивания
+        /** @brief Умножение на скаляр
+        @param a числовой множитель
+        @return <tt> *this </tt>
+        @post Умножает каждый элемент <tt> *this </tt> на @c a
+        */
+        constexpr static_math_vector & operator*=(T const & a)
+        {
+            for(auto & x : this->data_)
+            {
+                x *= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Деление на скаляр
+        @param a числовой множитель
+        @return <tt> *this </tt>
+        @post Делит каждый элемент <tt> *this </tt> на @c a
+        */
+        constexpr static_math_vector & operator/=(T const & a)
+        {
+            checking_policy::check_divisor_is_not_zero(a);
+
+            for(auto & x : this->data_)
+            {
+                x /= a;
+            }
+
+            return *this;
+        }
+
+        /** @brief Прибавление вектора
+        @param x прибавляемый вектор
+        @post Прибавляет к каждому элементу <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+        */
+        constexpr static_math_vector & operator+=(static_math_vector const & x)
+        {
+            for(auto i = std::size_t{0}; i != N; ++ i)
+            {
+                this->data_[i] += x.data_[i];
+            }
+
+            return *this;
+        }
+
+        /** @brief Вычитание вектора
+        @param x вычитаемый вектор
+        @post Вычитает из каждого элемента <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+        */
+        constexpr static_math_vector & operator-=(static_math_vector const & x)
+        {
+            for(auto i = std::size_t{0}; i != N; ++ i)
+            {
+                this->data_[i] -= x.data_[i];
+            }
+
+            return *this;
+        }
+
+        /** @brief Прибавление векторного выражения
+        @param x векторное выражение, например, @c math_vector
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post Прибавляет к каждому элементу <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+        */
+        template <class E>
+        static_math_vector & operator+=(vector_expression<E> const & x)
+        {
+            auto const & expr = x.derived();
+
+            checking_policy::check_equal_dimensions(*this, expr);
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
+            {
+                this->data_[i] += expr.element(i);
+            }
+
+            return *this;
+        }
+
+        /** @brief Вычитание векторного выражения
+        @param x векторное выражение, например, @c math_vector
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post Вычитает из каждого элемента <tt> *this </tt> соответсвующий элемент @c x
+        @return *this
+        */
+        template <class E>
+        static_math_vector & operator-=(vector_expression<E> const & x)
+        {
+            auto const & expr = x.derived();
+
+            checking_policy::check_equal_dimensions(*this, expr);
+
+            for(auto i = 0*expr.dim(); i != expr.dim(); ++ i)
+            {
+                this->data_[i] -= expr.element(i);
+            }
+
+            return *this;
+        }
+
+        // Итераторы
+        //@{
+        /** @brief Итератор начала последовательности элементов
+        @return Итератор, задающий начало последовательности элементов
+        */
+        constexpr iterator begin()
+        {
+            return this->data_;
+        }
+
+        constexpr const_iterator begin() const
+        {
+            return this->data_;
+        }
+        //@}
+
+        //@{
+        /** @brief Итератор конца последовательности элементов
+        @return Итератор, задающий конец последовательности элементов
+        */
+        constexpr iterator end()
+        {
+            return this->data_ + N;
+        }
+
+        constexpr const_iterator end() const
+        {
+            return this->data_ + N;
+        }
+        //@}
+
+    private:
+        T data_[N];
+    };
+
+    /** @brief Оператор "равно"
+    @param x, y аргументы
+    @return @b true, если все соответствующие элементы @c x и @c y равны, иначе --- @b false
+    */
+    template <class T, std::size_t N, class Check>
+    constexpr bool operator==(static_math_vector<T, N, Check> const & x,
+                              static_math_vector<T, N, Check> const & y)
+    {
+        for(auto i = 0*x.dim(); i != x.dim(); ++ i)
+        {
+            if(x.element(i) != y.element(i))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /** @brief Оператор "не равно"
+    @param x, y аргументы
+    @return <tt> !(x == y) </tt>
+    */
+    template <class T, std::size_t N, class Check>
+    constexpr bool operator!=(static_math_vector<T, N, Check> const & x,
+                              static_math_vector<T, N, Check> const & y)
+    {
+        return !(x == y);
+    }
+
+    /** @brief Оператор сложения векторов
+    @param x, y аргументы
+    @return Вектор, элементы которого равны сумме соответствующих элементов @c x и @c y
+
+    Оба аргумента передаются по значению, чтобы эта перегрузка была предпочтительнее операторов
+    над векторными выражениями, которые возвращают не вектор, а выражение.
+    */
+    template <class T, std::size_t N, class Check>
+    constexpr static_math_vector<T, N, Check>
+    operator+(static_math_vector<T, N, Check> x, static_math_vector<T, N, Check> y)
+    {
+        x += y;
+        return x;
+    }
+
+    /** @brief Оператор вычитания векторов
+    @param x, y аргументы
+    @return Вектор, элементы которого равны разности соответствующих элементов @c x и @c y
+    */
+    template <class T, std::size_t N, class Check>
+    constexpr static_math_vector<T, N, Check>
+    operator-(static_math_vector<T, N, Check> x, static_math_vector<T, N, Check> y)
+    {
+        x -= y;
+        return x;
+    }
+
+    /** @brief Умножение вектора на скаляр справа
+    @param x вектор
+    @param a скаляр
+    @return Вектор, элементы которого равны соответствующим элементам @c x, умноженным на @c a
+    */
+    template <class T, std::size_t N, class Check, class Scalar>
+    constexpr std::enable_if_t<std::is_convertible<Scalar, T>::value, static_math_vector<T, N, Check>>
+    operator*(static_math_vector<T, N, Check> x, Scalar const & a)
+    {
+        x *= a;
+        return x;
+    }
+
+    /** @brief Умножение вектора на скаляр слева
+    @param a скаляр
+    @param x вектор
+    @return Вектор, элементы которого равны @c a, умноженному на соответствующие элементы @c x
+    */
+    template <class Scalar, class T, std::size_t N, class Check>
+    constexpr std::enable_if_t<std::is_convertible<Scalar, T>::value, static_math_vector<T, N, Check>>
+    operator*(Scalar const & a, static_math_vector<T, N, Check> x)
+    {
+        for(auto & elem : x)
+        {
+            elem = a * elem;
+        }
+
+        return x;
+    }
+
+    /** @brief Деление вектора на скаляр
+    @param x вектор
+    @param a скаляр
+    @pre <tt> a != 0 </tt>
+    @return Вектор, элементы которого равны соответствующим элементам @c x, делённым на @c a
+    */
+    template <class T, std::size_t N, class Check, class Scalar>
+    constexpr std::enable_if_t<std::is_convertible<Scalar, T>::value, static_math_vector<T, N, Check>>
+    operator/(static_math_vector<T, N, Check> x, Scalar const & a)
+    {
+        x /= a;
+        return x;
+    }
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_STATIC_MATH_VECTOR_HPP_INCLUDED
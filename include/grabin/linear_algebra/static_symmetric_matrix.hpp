@@ -0,0 +1,367 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_STATIC_SYMMETRIC_MATRIX_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_STATIC_SYMMETRIC_MATRIX_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/static_symmetric_matrix.hpp
+ @brief Симметричные матрицы, размерность которых известна на этапе компиляции
+*/
+
+#include <grabin/linear_algebra/static_math_vector.hpp>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Симметричная матрица фиксированной размерности
+    @tparam T тип элементов
+    @tparam N размерность
+    @tparam Checking стратегия проверок и обработки ошибок
+
+    Нижний треугольник хранится построчно в массиве из <tt> N*(N+1)/2 </tt> элементов,
+    расположенном непосредственно в объекте.
+    */
+    template <class T, std::size_t N, class Checking = vector_policy_throws>
+    class static_symmetric_matrix
+    {
+        using Data = static_math_vector<T, N*(N+1)/2, Checking>;
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = Checking;
+
+        /// @brief Тип для представления размерности
+        using dimension_type = typename Data::dimension_type;
+
+        /// @brief Тип итератора
+        using iterator = typename Data::iterator;
+
+        /// @brief Тип константного итератора
+        using const_iterator = typename Data::const_iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор, создающий нулевую матрицу
+        @post <tt> (*this)(i, j) == 0 </tt> для любых <tt> 0 <= i, j < N </tt>
+        */
+        constexpr static_symmetric_matrix() = default;
+
+        /** @brief Конструктор, создающий матрицу, все элементы которой равны заданному значению
+        @param value значение элементов
+        @post <tt> (*this)(i, j) == value </tt> для любых <tt> 0 <= i, j < N </tt>
+        */
+        constexpr explicit static_symmetric_matrix(T const & value)
+         : data_(value)
+        {}
+
+        // Размер и ёмкость
+        /** @brief Размерность матрицы
+        @return @c N
+        */
+        constexpr dimension_type dim() const
+        {
+            return N;
+        }
+
+        // Доступ к элементам
+        //@{
+        /** @brief Доступ к элементам матрицы
+        @param row номер строки
+        @param col номер стоблца
+        @return Ссылка на элемент матрицы, находящий в строке @c row и столблце @c col
+        */
+        constexpr T const & operator()(dimension_type row, dimension_type col) const
+        {
+            return (col > row) ? data_[row_offset(col) + row] : data_[row_offset(row) + col];
+        }
+
+        constexpr T & operator()(dimension_type row, dimension_type col)
+        {
+            return (col > row) ? data_[row_offset(col) + row] : data_[row_offset(row) + col];
+        }
+        //@}
+
+        // Линейные операции
+        /** @brief Прибавление матрицы
+        @param x прибавляемая матрица
+        @post Прибавляет к каждому элементу <tt> *this </tt> соответсвующий элемент @c x
+        @return <tt> *this </tt>
+        */
+        constexpr static_symmetric_matrix & operator+=(static_symmetric_matrix const & x)
+        {
+            this->data_ += x.data_;
+
+            return *this;
+        }
+
+        /** @brief Вычитание матрицы
+        @param x вычитаемая матрица
+        @post Вычитает из каждого элемента <tt> *this </tt> соответсвующий элемент @c x
+        @return <tt> *this </tt>
+        */
+        constexpr static_symmetric_matrix & operator-=(static_symmetric_matrix const & x)
+        {
+            this->data_ -= x.data_;
+
+            return *this;
+        }
+
+        /** @brief Умножение матрицы на скаляр
+        @param alpha скаляр, на который умножается матрица
+        @post Уможает каждый элемент <tt> *this </tt> на @c alpha
+        @return <tt> *this </tt>
+        */
+        constexpr static_symmetric_matrix & operator*=(T const & alpha)
+        {
+            this->data_ *= alpha;
+
+            return *this;
+        }
+
+        /** @brief Деление матрицы на скаляр
+        @param alpha скаляр, на который делится матрица
+        @post Делит каждый элемент <tt> *this </tt> на @c alpha
+        @return <tt> *this </tt>
+        */
+        constexpr static_symmetric_matrix & operator/=(T const & alpha)
+        {
+            this->data_ /= alpha;
+
+            return *this;
+        }
+
+        /** @brief Симметричное обновление ранга 1
+        @tparam Compute тип, в котором выполняются вычисления
+        @param alpha скалярный множитель
+        @param x вектор
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post <tt> (*this)(i, j) += alpha * x[i] * x[j] </tt> для любых <tt> 0 <= i, j < N </tt>,
+        то есть <tt> A += alpha * x * x^T </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Compute = T, class Vector>
+        constexpr static_symmetric_matrix &
+        rank_one_update(details::non_deduced_t<Compute> const & alpha, Vector const & x)
+        {
+            checking_policy::check_equal_dimensions(*this, x);
+
+            auto const x_first = x.begin();
+            auto row = this->data_.begin();
+
+            for(auto i = 0*this->dim(); i < this->dim(); ++ i)
+            {
+                auto const a_i = alpha * static_cast<Compute>(x_first[i]);
+
+                for(auto j = 0*i; j <= i; ++ j)
+                {
+                    row[j] = static_cast<T>(row[j] + a_i * static_cast<Compute>(x_first[j]));
+                }
+
+                row += i + 1;
+            }
+
+            return *this;
+        }
+
+        /** @brief Симметричное обновление ранга 2
+        @tparam Compute тип, в котором выполняются вычисления
+        @param alpha скалярный множитель
+        @param x, y векторы
+        @pre <tt> this->dim() == x.dim() && this->dim() == y.dim() </tt>
+        @post <tt> (*this)(i, j) += alpha * (x[i] * y[j] + y[i] * x[j]) </tt> для любых
+        <tt> 0 <= i, j < N </tt>, то есть <tt> A += alpha * (x * y^T + y * x^T) </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Compute = T, class Vector1, class Vector2>
+        constexpr static_symmetric_matrix &
+        rank_two_update(details::non_deduced_t<Compute> const & alpha,
+                        Vector1 const & x, Vector2 const & y)
+        {
+            checking_policy::check_equal_dimensions(*this, x);
+            checking_policy::check_equal_dimensions(*this, y);
+
+            auto const x_first = x.begin();
+            auto const y_first = y.begin();
+            auto row = this->data_.begin();
+
+            for(auto i = 0*this->dim(); i < this->dim(); ++ i)
+            {
+                auto const ax_i = alpha * static_cast<Compute>(x_first[i]);
+                auto const ay_i = alpha * static_cast<Compute>(y_first[i]);
+
+                for(auto j = 0*i; j <= i; ++ j)
+                {
+                    row[j] = static_cast<T>(row[j] + (ax_i * static_cast<Compute>(y_first[j])
+                                                      + ay_i * static_cast<Compute>(x_first[j])));
+                }
+
+                row += i + 1;
+            }
+
+            return *this;
+        }
+
+        /** @brief Симметричное обновление ранга k
+        @tparam Compute тип, в котором выполняются вычисления
+        @param alpha скалярный множитель
+        @param first, last интервал, задающий последовательность векторов
+        @param shift вектор сдвига
+        @pre <tt> this->dim() == shift.dim() </tt>, размерность каждого вектора из
+        <tt> [first; last) </tt> равна <tt> this->dim() </tt>
+        @post К <tt> *this </tt> прибавлена сумма <tt> alpha * (x - shift) * (x - shift)^T </tt> по
+        всем @c x из <tt> [first; last) </tt>
+        @return <tt> *this </tt>
+
+        Матрица целиком помещается в кэш, поэтому векторы обрабатываются по одному, а разности
+        хранятся на стеке в типе @c Compute.
+        */
+        template <class Compute = T, class ForwardIterator, class Vector>
+        constexpr static_symmetric_matrix &
+        rank_k_update(details::non_deduced_t<Compute> const & alpha,
+                      ForwardIterator first, ForwardIterator last, Vector const & shift)
+        {
+            checking_policy::check_equal_dimensions(*this, shift);
+
+            auto const shift_first = shift.begin();
+
+            for(; first != last; ++ first)
+            {
+                auto const & x = *first;
+                checking_policy::check_equal_dimensions(*this, x);
+
+                auto const x_first = x.begin();
+
+                static_math_vector<Compute, N, Checking> d;
+
+                for(auto i = 0*this->dim(); i < this->dim(); ++ i)
+                {
+                    d.begin()[i] = static_cast<Compute>(x_first[i])
+                                 - static_cast<Compute>(shift_first[i]);
+                }
+
+                this->template rank_one_update<Compute>(alpha, d);
+            }
+
+            return *this;
+        }
+
+        // Итераторы
+        //@{
+        /** @brief Итератор начала последовательности элементов
+        @return Итератор, задающий начало последовательности элементов
+        */
+        constexpr iterator begin()
+        {
+            return this->data_.begin();
+        }
+
+        constexpr const_iterator begin() const
+        {
+            return this->data_.begin();
+        }
+        //@}
+
+        //@{
+        /** @brief Итератор конца последовательности элементов
+        @return Итератор, задающий конец последовательности элементов
+        */
+        constexpr iterator end()
+        {
+            return this->data_.end();
+        }
+
+        constexpr const_iterator end() const
+        {
+            return this->data_.end();
+        }
+        //@}
+
+    private:
+        static constexpr dimension_type row_offset(dimension_type row)
+        {
+            return row*(row+1)/2;
+        }
+
+        Data data_;
+    };
+
+    /** @brief Оператор сложения матриц
+    @param x, y аргументы
+    @return Матрица, элементы которой равны сумме соответствующих элементов матриц @c x и @c y
+    */
+    template <class T, std::size_t N, class Check>
+    constexpr static_symmetric_matrix<T, N, Check>
+    operator+(static_symmetric_matrix<T, N, Check> x, static_symmetric_matrix<T, N, Check> const & y)
+    {
+        x += y;
+        return x;
+    }
+
+    /** @brief Умножение матрицы на скаляр справа
+    @param x матрица
+    @param alpha скаляр
+    @return Матрица, элементы которой равны соответствующим элементам @c x, умноженным на @c alpha
+    */
+    template <class T, std::size_t N, class Check, class Scalar>
+    constexpr std::enable_if_t<std::is_convertible<Scalar, T>::value,
+                               static_symmetric_matrix<T, N, Check>>
+    operator*(static_symmetric_matrix<T, N, Check> x, Scalar const & alpha)
+    {
+        x *= alpha;
+        return x;
+    }
+
+    /** @brief Умножение матрицы на скаляр слева
+    @param alpha скаляр
+    @param x матрица
+    @return Матрица, элементы которой равны @c alpha, умноженному соответствующим элементам @c x
+    */
+    template <class Scalar, class T, std::size_t N, class Check>
+    constexpr std::enable_if_t<std::is_convertible<Scalar, T>::value,
+                               static_symmetric_matrix<T, N, Check>>
+    operator*(Scalar const & alpha, static_symmetric_matrix<T, N, Check> x)
+    {
+        for(auto & elem : x)
+        {
+            elem = alpha * elem;
+        }
+
+        return x;
+    }
+
+    /** @brief Оператор деления матрицы на скаляр
+    @param x матрица
+    @param alpha скаляр
+    @pre <tt> alpha != 0 </tt>
+    @return Матрица, элементы которой равны соответствующим элементам @c x, делённым на @c alpha
+    */
+    template <class T, std::size_t N, class Check, class Scalar>
+    constexpr std::enable_if_t<std::is_convertible<Scalar, T>::value,
+                               static_symmetric_matrix<T, N, Check>>
+    operator/(static_symmetric_matrix<T, N, Check> x, Scalar const & alpha)
+    {
+        x /= alpha;
+        return x;
+    }
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_STATIC_SYMMETRIC_MATRIX_HPP_INCLUDED
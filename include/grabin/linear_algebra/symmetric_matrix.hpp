@@ -20,45 +20,260 @@
  @brief Класс симметричной матрицы
 */
 
+#include <grabin/linear_algebra/aligned_allocator.hpp>
 #include <grabin/linear_algebra/math_vector.hpp>
 
+#include <iterator>
+#include <memory>
+
 namespace grabin
 {
 inline namespace v0
 {
+    /** @brief Размещение строк нижнего треугольника симметричной матрицы в памяти без промежутков
+
+    Элемент <tt> (i, j) </tt>, <tt> j <= i </tt> хранится по смещению <tt> i*(i+1)/2 + j </tt>.
+    */
+    struct packed_rows_layout
+    {
+        /** @brief Смещение начала строки
+        @tparam T тип элементов
+        @param row номер строки
+        @return Смещение первого элемента строки @c row относительно начала массива
+        */
+        template <class T, class Dimension>
+        static constexpr Dimension row_offset(Dimension row)
+        {
+            return row*(row+1)/2;
+        }
+    };
+
+    /** @brief Размещение строк нижнего треугольника симметричной матрицы в памяти, при котором
+    каждая строка дополняется до размера, кратного @c Alignment байт
+    @tparam Alignment выравнивание строк в байтах
+
+    Если начало массива выравнено по границе @c Alignment, то и начало каждой строки выравнено по
+    этой границе, поэтому строки не начинаются в середине кэш-линии. Элементы-заполнители равны
+    нулю и не видны через интерфейс матрицы.
+    */
+    template <std::size_t Alignment>
+    struct padded_rows_layout
+    {
+        /** @brief Смещение начала строки
+        @tparam T тип элементов
+        @param row номер строки
+        @return Смещение первого элемента строки @c row относительно начала массива
+        */
+        template <class T, class Dimension>
+        static constexpr Dimension row_offset(Dimension row)
+        {
+            // Количество элементов в выравненном блоке, строка длины k занимает ceil(k/w) блоков
+            auto const w = Dimension(Alignment % sizeof(T) == 0 ? Alignment / sizeof(T) : 1);
+            auto const q = row / w;
+            auto const r = row % w;
+
+            return w * (w * q * (q + 1) / 2 + r * (q + 1));
+        }
+    };
+
+    /** @brief Класс-характеристика для определения размещения строк симметричной матрицы,
+    используемого по умолчанию
+    @tparam Alloc тип распределителя памяти
+
+    Для распределителей, выравнивающих память, строки дополняются до границы выравнивания.
+    */
+    template <class Alloc>
+    struct default_symmetric_matrix_layout
+    {
+        /// @brief Тип размещения строк
+        using type = packed_rows_layout;
+    };
+
+    template <class T, std::size_t Alignment>
+    struct default_symmetric_matrix_layout<aligned_allocator<T, Alignment>>
+    {
+        using type = padded_rows_layout<Alignment>;
+    };
+
+    /** @brief Итератор элементов нижнего треугольника, строки которого дополнены заполнителями
+    @tparam Iterator тип итератора массива
+    @tparam Layout тип размещения строк
+
+    Элементы перебираются построчно в том же порядке, что и при размещении без промежутков,
+    элементы-заполнители пропускаются.
+    */
+    template <class Iterator, class Layout>
+    class padded_rows_iterator
+    {
+    public:
+        // Типы
+        /// @brief Категория итератора
+        using iterator_category = std::forward_iterator_tag;
+
+        /// @brief Тип значения
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+        /// @brief Тип расстояния
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+        /// @brief Тип ссылки
+        using reference = typename std::iterator_traits<Iterator>::reference;
+
+        /// @brief Тип указателя
+        using pointer = typename std::iterator_traits<Iterator>::pointer;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param pos итератор элемента массива, являющегося первым элементом строки @c row
+        @param row номер строки
+        */
+        padded_rows_iterator(Iterator pos, difference_type row)
+         : pos_(pos)
+         , row_(row)
+         , col_(0)
+        {}
+
+        // Доступ к элементам
+        /** @brief Доступ к текущему элементу
+        @return Ссылка на текущий элемент
+        */
+        reference operator*() const
+        {
+            return *this->pos_;
+        }
+
+        /** @brief Доступ к членам текущего элемента
+        @return Указатель на текущий элемент
+        */
+        pointer operator->() const
+        {
+            return &*this->pos_;
+        }
+
+        // Перемещение
+        /** @brief Переход к следующему элементу
+        @return <tt> *this </tt>
+        */
+        padded_rows_iterator & operator++()
+        {
+            if(this->col_ < this->row_)
+            {
+                ++ this->col_;
+                ++ this->pos_;
+            }
+            else
+            {
+                this->pos_ += Layout::template row_offset<value_type>(this->row_ + 1)
+                              - Layout::template row_offset<value_type>(this->row_) - this->col_;
+                ++ this->row_;
+                this->col_ = 0;
+            }
+
+            return *this;
+        }
+
+        /** @brief Переход к следующему элементу
+        @return Копия значения итератора до перехода
+        */
+        padded_rows_iterator operator++(int)
+        {
+            auto result = *this;
+            ++ *this;
+            return result;
+        }
+
+        // Сравнение
+        //@{
+        /** @brief Сравнение итераторов одной и той же матрицы
+        @param x, y итераторы
+        @return @b true, если итераторы ссылаются на один и тот же элемент, иначе --- @b false
+        */
+        friend bool operator==(padded_rows_iterator const & x, padded_rows_iterator const & y)
+        {
+            return x.pos_ == y.pos_;
+        }
+
+        friend bool operator!=(padded_rows_iterator const & x, padded_rows_iterator const & y)
+        {
+            return !(x == y);
+        }
+        //@}
+
+    private:
+        Iterator pos_;
+        difference_type row_;
+        difference_type col_;
+    };
+
     /** @brief Симметричная матрица
     @tparam T тип элементов
     @tparam Checking стратегия проверок и обработки ошибок
+    @tparam Alloc тип распределителя памяти
+    @tparam Layout тип размещения строк нижнего треугольника в памяти
     */
-    template <class T, class Checking = vector_policy_throws>
+    template <class T, class Checking = vector_policy_throws, class Alloc = std::allocator<T>,
+              class Layout = typename default_symmetric_matrix_layout<Alloc>::type>
     class symmetric_matrix
     {
-        using Data = math_vector<T>;
+        using Data = math_vector<T, vector_policy_throws, Alloc>;
+
+        static constexpr bool is_packed = std::is_same<Layout, packed_rows_layout>::value;
+
     public:
         // Типы
+        /// @brief Тип элементов
+        using value_type = T;
+
         /// @brief Стратегия проверки и обработки ошибок
         using checking_policy = Checking;
 
+        /// @brief Тип распределителя памяти
+        using allocator_type = Alloc;
+
+        /// @brief Тип размещения строк в памяти
+        using layout_type = Layout;
+
         /// @brief Тип для представления размерности
         using dimension_type = typename Data::dimension_type;
 
         /// @brief Тип итератора
-        using iterator = typename Data::iterator;
+        using iterator = std::conditional_t<is_packed, typename Data::iterator,
+                                            padded_rows_iterator<typename Data::iterator, Layout>>;
 
         /// @brief Тип константного итератора
-        using const_iterator = typename Data::const_iterator;
+        using const_iterator
+            = std::conditional_t<is_packed, typename Data::const_iterator,
+                                 padded_rows_iterator<typename Data::const_iterator, Layout>>;
 
         // Создание, копирование, уничтожение
         /** @brief Конструктор, создающий нулевую матрицу
         @param n размерность
+        @param alloc распределитель памяти
         @post <tt> this->dim() == n </tt>
         @post <tt> (*this)(i, j) == 0 </tt> для любых <tt> 0 <= i, j < n </tt>
         */
-        explicit symmetric_matrix(dimension_type n)
+        explicit symmetric_matrix(dimension_type n, Alloc const & alloc = Alloc())
          : dim_(n)
-         , data_(n*(n+1)/2)
+         , data_(symmetric_matrix::row_offset(n), alloc)
         {}
 
+        /** @brief Создаёт копию матрицы, использующую заданный распределитель памяти
+        @param x копируемая матрица
+        @param alloc распределитель памяти
+        */
+        symmetric_matrix(symmetric_matrix const & x, Alloc const & alloc)
+         : dim_(x.dim_)
+         , data_(x.data_, alloc)
+        {}
+
+        /** @brief Распределитель памяти
+        @return Копия распределителя памяти, используемого матрицей
+        */
+        allocator_type get_allocator() const
+        {
+            return this->data_.get_allocator();
+        }
+
         // Размер и ёмкость
         /** @brief Размерность матрицы
         @return Размерность матрицы
@@ -83,7 +298,7 @@ inline namespace v0
                 swap(col, row);
             }
 
-            return data_[row*(row+1)/2 + col];
+            return data_[symmetric_matrix::row_offset(row) + col];
         }
 
         T & operator()(dimension_type row, dimension_type col)
@@ -92,6 +307,24 @@ inline namespace v0
         }
         //@}
 
+        //@{
+        /** @brief Доступ к строке нижнего треугольника
+        @param row номер строки
+        @pre <tt> 0 <= row && row < this->dim() </tt>
+        @return Указатель на элемент <tt> (row, 0) </tt>. Элементы <tt> (row, j) </tt>,
+        <tt> 0 <= j <= row </tt> расположены в памяти подряд.
+        */
+        T const * row_data(dimension_type row) const
+        {
+            return this->data_.data() + symmetric_matrix::row_offset(row);
+        }
+
+        T * row_data(dimension_type row)
+        {
+            return this->data_.data() + symmetric_matrix::row_offset(row);
+        }
+        //@}
+
         // Линейные операции
         /** @brief Прибавление матрицы
         @param x прибавляемая матрица
@@ -108,6 +341,21 @@ inline namespace v0
             return *this;
         }
 
+        /** @brief Вычитание матрицы
+        @param x вычитаемая матрица
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post Вычитает из каждого элемента <tt> *this </tt> соответсвующий элемент @c x
+        @return <tt> *this </tt>
+        */
+        symmetric_matrix & operator-=(symmetric_matrix const & x)
+        {
+            checking_policy::check_equal_dimensions(*this, x);
+
+            this->data_ -= x.data_;
+
+            return *this;
+        }
+
         /** @brief Умножение матрицы на скаляр
         @param alpha скаляр, на который умножается матрица
         @post Уможает каждый элемент <tt> *this </tt> на @c alpha
@@ -132,6 +380,118 @@ inline namespace v0
             return *this;
         }
 
+        /** @brief Симметричное обновление ранга 1
+        @tparam Compute тип, в котором выполняются вычисления
+        @param alpha скалярный множитель
+        @param x вектор
+        @pre <tt> this->dim() == x.dim() </tt>
+        @post <tt> (*this)(i, j) += alpha * x[i] * x[j] </tt> для любых <tt> 0 <= i, j < n </tt>,
+        то есть <tt> A += alpha * x * x^T </tt>
+        @return <tt> *this </tt>
+
+        Если @c Compute шире @c T (например, <tt> symmetric_matrix<float> </tt> обновляется с
+        <tt> Compute = double </tt>), то элементы @c x и матрицы преобразуются к @c Compute, а
+        результат каждого обновления округляется до @c T один раз.
+
+        Если <tt> Compute == T </tt>, а элементы @c x хранятся непрерывно (есть функция-член
+        @c data), то каждая строка упакованного треугольника обновляется функцией @c simd::axpy.
+        */
+        template <class Compute = T, class Vector>
+        symmetric_matrix & rank_one_update(details::non_deduced_t<Compute> const & alpha,
+                                           Vector const & x)
+        {
+            checking_policy::check_equal_dimensions(*this, x);
+
+            this->rank_one_rows(alpha, x, 0);
+
+            return *this;
+        }
+
+        /** @brief Симметричное обновление ранга 2
+        @tparam Compute тип, в котором выполняются вычисления
+        @param alpha скалярный множитель
+        @param x, y векторы
+        @pre <tt> this->dim() == x.dim() && this->dim() == y.dim() </tt>
+        @post <tt> (*this)(i, j) += alpha * (x[i] * y[j] + y[i] * x[j]) </tt> для любых
+        <tt> 0 <= i, j < n </tt>, то есть <tt> A += alpha * (x * y^T + y * x^T) </tt>
+        @return <tt> *this </tt>
+
+        Если <tt> Compute == T </tt>, а элементы @c x и @c y хранятся непрерывно, то к каждой
+        строке упакованного треугольника применяются два вызова @c simd::axpy.
+        */
+        template <class Compute = T, class Vector1, class Vector2>
+        symmetric_matrix & rank_two_update(details::non_deduced_t<Compute> const & alpha,
+                                           Vector1 const & x, Vector2 const & y)
+        {
+            checking_policy::check_equal_dimensions(*this, x);
+            checking_policy::check_equal_dimensions(*this, y);
+
+            this->rank_two_rows(alpha, x, y, 0);
+
+            return *this;
+        }
+
+        /** @brief Симметричное обновление ранга k
+        @tparam Compute тип, в котором выполняются вычисления
+        @param alpha скалярный множитель
+        @param first, last интервал, задающий последовательность векторов
+        @param shift вектор сдвига
+        @pre <tt> this->dim() == shift.dim() </tt>, размерность каждого вектора из
+        <tt> [first; last) </tt> равна <tt> this->dim() </tt>
+        @post К <tt> *this </tt> прибавлена сумма <tt> alpha * (x - shift) * (x - shift)^T </tt> по
+        всем @c x из <tt> [first; last) </tt>
+        @return <tt> *this </tt>
+
+        Векторы обрабатываются блоками: каждый блок копируется (со сдвигом) в непрерывный буфер,
+        после чего строки упакованного треугольника обновляются полосами, помещающимися в кэш, так
+        что каждая полоса загружается из памяти один раз на блок, а не один раз на вектор. Разности
+        вычисляются и хранятся в буфере в типе @c Compute, поэтому при <tt> Compute = double </tt>
+        матрица типа <tt> symmetric_matrix<float> </tt> обновляется без потери точности
+        отклонений, а преобразование к более широкому типу выполняется один раз для каждого
+        элемента блока.
+        */
+        template <class Compute = T, class ForwardIterator, class Vector>
+        symmetric_matrix & rank_k_update(details::non_deduced_t<Compute> const & alpha,
+                                         ForwardIterator first, ForwardIterator last,
+                                         Vector const & shift)
+        {
+            checking_policy::check_equal_dimensions(*this, shift);
+
+            auto const n = this->dim();
+            auto const block_size = dimension_type{256};
+            auto const shift_first = shift.begin();
+
+            using Compute_alloc
+                = typename std::allocator_traits<Alloc>::template rebind_alloc<Compute>;
+
+            std::vector<Compute, Compute_alloc> block(Compute_alloc(this->get_allocator()));
+            block.reserve(block_size * n);
+
+            while(first != last)
+            {
+                block.clear();
+
+                auto k = dimension_type{0};
+                for(; first != last && k < block_size; ++ first, ++ k)
+                {
+                    auto const & x = *first;
+                    checking_policy::check_equal_dimensions(*this, x);
+
+                    auto const x_first = x.begin();
+
+                    for(auto i = 0*n; i < n; ++ i)
+                    {
+                        block.push_back(static_cast<Compute>(x_first[i])
+                                        - static_cast<Compute>(shift_first[i]));
+                    }
+                }
+
+                this->rank_k_update_block(alpha, block.data(), k);
+            }
+
+            return *this;
+        }
+
         // Итераторы
         //@{
         /** @brief Итератор начала последовательности элементов
@@ -139,12 +499,12 @@ inline namespace v0
         */
         iterator begin()
         {
-            return this->data_.begin();
+            return symmetric_matrix::make_iterator<iterator>(this->data_.begin(), 0);
         }
 
         const_iterator begin() const
         {
-            return this->data_.begin();
+            return symmetric_matrix::make_iterator<const_iterator>(this->data_.begin(), 0);
         }
         //@}
 
@@ -154,28 +514,283 @@ inline namespace v0
         */
         iterator end()
         {
-            return this->data_.end();
+            return symmetric_matrix::make_iterator<iterator>(this->data_.end(), this->dim());
         }
 
         const_iterator end() const
         {
-            return this->data_.end();
+            return symmetric_matrix::make_iterator<const_iterator>(this->data_.end(), this->dim());
         }
         //@}
 
     private:
+        // Строка i упакованного треугольника: row[0..i] += alpha * x[i] * x[0..i]
+        template <class Compute, class Vector>
+        auto rank_one_rows(Compute const & alpha, Vector const & x, int)
+        -> std::enable_if_t<std::is_same<Compute, T>::value
+                            && std::is_convertible<decltype(x.data()), T const *>::value>
+        {
+            auto const isa = simd::supported_instruction_set();
+            auto const x_data = static_cast<T const *>(x.data());
+            auto row = this->data_.data();
+
+            for(auto i = 0*this->dim(); i < this->dim(); ++ i)
+            {
+                simd::axpy(row, T(alpha * x_data[i]), x_data, static_cast<std::size_t>(i + 1),
+                           isa);
+
+                row += symmetric_matrix::row_size(i);
+            }
+        }
+
+        template <class Compute, class Vector>
+        void rank_one_rows(Compute const & alpha, Vector const & x, long)
+        {
+            auto const x_first = x.begin();
+            auto row = this->data_.begin();
+
+            for(auto i = 0*this->dim(); i < this->dim(); ++ i)
+            {
+                auto const a_i = alpha * static_cast<Compute>(x_first[i]);
+
+                for(auto j = 0*i; j <= i; ++ j)
+                {
+                    row[j] = static_cast<T>(row[j] + a_i * static_cast<Compute>(x_first[j]));
+                }
+
+                row += symmetric_matrix::row_size(i);
+            }
+        }
+
+        // Строка i: row[0..i] += alpha * x[i] * y[0..i] + alpha * y[i] * x[0..i]
+        template <class Compute, class Vector1, class Vector2>
+        auto rank_two_rows(Compute const & alpha, Vector1 const & x, Vector2 const & y, int)
+        -> std::enable_if_t<std::is_same<Compute, T>::value
+                            && std::is_convertible<decltype(x.data()), T const *>::value
+                            && std::is_convertible<decltype(y.data()), T const *>::value>
+        {
+            auto const isa = simd::supported_instruction_set();
+            auto const x_data = static_cast<T const *>(x.data());
+            auto const y_data = static_cast<T const *>(y.data());
+            auto row = this->data_.data();
+
+            for(auto i = 0*this->dim(); i < this->dim(); ++ i)
+            {
+                auto const n = static_cast<std::size_t>(i + 1);
+
+                simd::axpy(row, T(alpha * x_data[i]), y_data, n, isa);
+                simd::axpy(row, T(alpha * y_data[i]), x_data, n, isa);
+
+                row += symmetric_matrix::row_size(i);
+            }
+        }
+
+        template <class Compute, class Vector1, class Vector2>
+        void rank_two_rows(Compute const & alpha, Vector1 const & x, Vector2 const & y, long)
+        {
+            auto const x_first = x.begin();
+            auto const y_first = y.begin();
+            auto row = this->data_.begin();
+
+            for(auto i = 0*this->dim(); i < this->dim(); ++ i)
+            {
+                auto const ax_i = alpha * static_cast<Compute>(x_first[i]);
+                auto const ay_i = alpha * static_cast<Compute>(y_first[i]);
+
+                for(auto j = 0*i; j <= i; ++ j)
+                {
+                    row[j] = static_cast<T>(row[j] + (ax_i * static_cast<Compute>(y_first[j])
+                                                      + ay_i * static_cast<Compute>(x_first[j])));
+                }
+
+                row += symmetric_matrix::row_size(i);
+            }
+        }
+
+        static dimension_type row_offset(dimension_type row)
+        {
+            return Layout::template row_offset<T>(row);
+        }
+
+        // Количество элементов, занимаемых строкой, с учётом заполнителей
+        static dimension_type row_size(dimension_type row)
+        {
+            return row_offset(row + 1) - row_offset(row);
+        }
+
+        template <class Iterator, class Base>
+        static std::enable_if_t<std::is_same<Iterator, Base>::value, Iterator>
+        make_iterator(Base pos, dimension_type)
+        {
+            return pos;
+        }
+
+        template <class Iterator, class Base>
+        static std::enable_if_t<!std::is_same<Iterator, Base>::value, Iterator>
+        make_iterator(Base pos, dimension_type row)
+        {
+            return Iterator(pos, row);
+        }
+
+        // Обновление ранга k по блоку из k векторов, хранящихся в X построчно
+        template <class Compute>
+        void rank_k_update_block(Compute const & alpha, Compute const * X, dimension_type k)
+        {
+            auto const n = this->dim();
+
+            // Количество элементов полосы строк, которая должна помещаться в кэш первого уровня
+            auto const band_size = dimension_type{4096};
+
+            for(auto row_first = 0*n; row_first < n;)
+            {
+                auto row_last = row_first + 1;
+
+                while(row_last < n
+                      && row_offset(row_last + 1) - row_offset(row_first) <= band_size)
+                {
+                    ++ row_last;
+                }
+
+                this->rank_k_band(alpha, X, k, row_first, row_last, 0);
+
+                row_first = row_last;
+            }
+        }
+
+        // Строки [row_first; row_last) полосы: по четыре вектора за раз, чтобы каждый элемент
+        // матрицы загружался и сохранялся один раз на четыре произведения
+        template <class Compute>
+        auto rank_k_band(Compute const & alpha, Compute const * X, dimension_type k,
+                         dimension_type row_first, dimension_type row_last, int)
+        -> std::enable_if_t<std::is_same<Compute, T>::value>
+        {
+            auto const n = this->dim();
+            auto const isa = simd::supported_instruction_set();
+            auto const band = this->data_.data() + row_offset(row_first);
+
+            auto r = 0*k;
+            for(; r + 4 <= k; r += 4)
+            {
+                T const * const x[4] = {X + r*n, X + (r + 1)*n, X + (r + 2)*n, X + (r + 3)*n};
+
+                auto row = band;
+
+                for(auto i = row_first; i < row_last; ++ i)
+                {
+                    T const a[4] = {T(alpha * x[0][i]), T(alpha * x[1][i]),
+                                    T(alpha * x[2][i]), T(alpha * x[3][i])};
+
+                    simd::axpy4(row, a, x, static_cast<std::size_t>(i + 1), isa);
+
+                    row += symmetric_matrix::row_size(i);
+                }
+            }
+
+            for(; r < k; ++ r)
+            {
+                auto const x0 = X + r*n;
+
+                auto row = band;
+
+                for(auto i = row_first; i < row_last; ++ i)
+                {
+                    simd::axpy(row, T(alpha * x0[i]), x0, static_cast<std::size_t>(i + 1), isa);
+
+                    row += symmetric_matrix::row_size(i);
+                }
+            }
+        }
+
+        template <class Compute>
+        void rank_k_band(Compute const & alpha, Compute const * X, dimension_type k,
+                         dimension_type row_first, dimension_type row_last, long)
+        {
+            auto const n = this->dim();
+            auto const band = this->data_.begin() + row_offset(row_first);
+
+            // По четыре вектора за раз: одна загрузка элемента матрицы на четыре произведения
+            auto r = 0*k;
+            for(; r + 4 <= k; r += 4)
+            {
+                auto const x0 = X + r*n;
+                auto const x1 = x0 + n;
+                auto const x2 = x1 + n;
+                auto const x3 = x2 + n;
+
+                auto row = band;
+
+                for(auto i = row_first; i < row_last; ++ i)
+                {
+                    auto const a0 = alpha * x0[i];
+                    auto const a1 = alpha * x1[i];
+                    auto const a2 = alpha * x2[i];
+                    auto const a3 = alpha * x3[i];
+
+                    for(auto j = 0*i; j <= i; ++ j)
+                    {
+                        row[j] = static_cast<T>(row[j] + (a0 * x0[j] + a1 * x1[j]
+                                                          + a2 * x2[j] + a3 * x3[j]));
+                    }
+
+                    row += symmetric_matrix::row_size(i);
+                }
+            }
+
+            for(; r < k; ++ r)
+            {
+                auto const x0 = X + r*n;
+
+                auto row = band;
+
+                for(auto i = row_first; i < row_last; ++ i)
+                {
+                    auto const a0 = alpha * x0[i];
+
+                    for(auto j = 0*i; j <= i; ++ j)
+                    {
+                        row[j] = static_cast<T>(row[j] + a0 * x0[j]);
+                    }
+
+                    row += symmetric_matrix::row_size(i);
+                }
+            }
+        }
+
         dimension_type dim_;
         Data data_;
     };
 
+    /** @brief Симметричная матрица, элементы которой хранятся в памяти, выравненной по границе
+    кэш-линии, а строки нижнего треугольника дополнены до размера, кратного размеру кэш-линии
+    @tparam T тип элементов
+    @tparam Checking стратегия проверок и обработки ошибок
+    */
+    template <class T, class Checking = vector_policy_throws>
+    using aligned_symmetric_matrix = symmetric_matrix<T, Checking, aligned_allocator<T>>;
+
+#if __cplusplus >= 201703L
+namespace pmr
+{
+    /** @brief Симметричная матрица, использующая полиморфный распределитель памяти
+    @tparam T тип элементов
+    @tparam Checking стратегия проверок и обработки ошибок
+    */
+    template <class T, class Checking = vector_policy_throws>
+    using symmetric_matrix
+        = ::grabin::symmetric_matrix<T, Checking, std::pmr::polymorphic_allocator<T>>;
+}
+// namespace pmr
+#endif
+
     /** @brief Оператор сложения матриц
     @param x, y аргументы
     @pre <tt> x.dim() == y.dim() </tt>
     @return Матрица, элементы которой равны сумме соответствующих элементов матриц @c x и @c y
     */
-    template <class T, class Check>
-    symmetric_matrix<T, Check>
-    operator+(symmetric_matrix<T, Check> x, symmetric_matrix<T, Check> const & y)
+    template <class T, class Check, class Alloc, class Layout>
+    symmetric_matrix<T, Check, Alloc, Layout>
+    operator+(symmetric_matrix<T, Check, Alloc, Layout> x,
+              symmetric_matrix<T, Check, Alloc, Layout> const & y)
     {
         x += y;
         return x;
@@ -186,11 +801,12 @@ inline namespace v0
     @param alpha скаляр
     @return Матрица, элементы которой равны соответствующим элементам @c x, умноженным на @c alpha
     */
-    template <class T1, class Check, class T2>
-    auto operator*(symmetric_matrix<T1, Check> x, T2 const & alpha)
-    -> symmetric_matrix<decltype(x(0, 0)*alpha), Check>
+    template <class T1, class Check, class Alloc, class Layout, class T2,
+              class = std::enable_if_t<!is_vector_expression<T2>::value>>
+    auto operator*(symmetric_matrix<T1, Check, Alloc, Layout> x, T2 const & alpha)
+    -> symmetric_matrix<decltype(x(0, 0)*alpha), Check, Alloc, Layout>
     {
-        symmetric_matrix<decltype(x(0, 0)*alpha), Check> result(std::move(x));
+        symmetric_matrix<decltype(x(0, 0)*alpha), Check, Alloc, Layout> result(std::move(x));
         result *= alpha;
         return result;
     }
@@ -200,9 +816,9 @@ inline namespace v0
     @param alpha скаляр
     @return Матрица, элементы которой равны @c alpha, умноженному соответствующим элементам @c x
     */
-    template <class T1, class T2, class Check>
-    auto operator*(T1 const & alpha, symmetric_matrix<T2, Check> x)
-    -> symmetric_matrix<decltype(alpha*x(0, 0)), Check>
+    template <class T1, class T2, class Check, class Alloc, class Layout>
+    auto operator*(T1 const & alpha, symmetric_matrix<T2, Check, Alloc, Layout> x)
+    -> symmetric_matrix<decltype(alpha*x(0, 0)), Check, Alloc, Layout>
     {
         for(auto & elem : x)
         {
@@ -218,11 +834,12 @@ inline namespace v0
     @post <tt> alpha != 0 </tt>
     @return Матрица, элементы которого равны соответствующим элементам @c x, делённым на @c a
     */
-    template <class T1, class Check, class T2>
-    auto operator/(symmetric_matrix<T1, Check> x, T2 const & alpha)
-    -> symmetric_matrix<decltype(x(0,0) / alpha), Check>
+    template <class T1, class Check, class Alloc, class Layout, class T2>
+    auto operator/(symmetric_matrix<T1, Check, Alloc, Layout> x, T2 const & alpha)
+    -> symmetric_matrix<decltype(x(0,0) / alpha), Check, Alloc, Layout>
     {
-        auto result = symmetric_matrix<decltype(x(0,0)/alpha), Check>(std::move(x));
+        auto result
+            = symmetric_matrix<decltype(x(0,0)/alpha), Check, Alloc, Layout>(std::move(x));
         result /= alpha;
         return result;
     }
@@ -0,0 +1,675 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_LINEAR_ALGEBRA_VECTOR_EXPRESSION_HPP_INCLUDED
+#define Z_GRABIN_LINEAR_ALGEBRA_VECTOR_EXPRESSION_HPP_INCLUDED
+
+/** @file grabin/linear_algebra/vector_expression.hpp
+ @brief Шаблоны выражений для ленивых (отложенных) вычислений с векторами
+
+ Арифметические операции над векторами возвращают не новый вектор, а объект-выражение, который
+ хранит аргументы и вычисляет элементы по требованию. Выражение вычисляется за один проход при
+ присваивании вектору, поэтому выражения вида <tt> a*x + b*y - z </tt> не создают промежуточных
+ векторов.
+
+ Аргументы, являющиеся lvalue, хранятся в выражении по ссылке, а rvalue --- по значению, поэтому
+ выражение можно сохранить в переменной, если его lvalue-аргументы существуют дольше него.
+
+ Если хотя бы у одного из векторных аргументов есть функция-член @c get_allocator, то она есть и
+ у выражения и возвращает распределитель памяти первого такого аргумента, поэтому вектор,
+ созданный из выражения, использует тот же распределитель, что и аргументы.
+*/
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Базовый класс для векторов и векторных выражений
+    @tparam Derived тип-наследник
+
+    Наследник должен определять типы @c value_type, @c dimension_type и @c checking_policy, а
+    также функции-члены <tt> dim() </tt> и <tt> element(i) </tt>, последняя из которых возвращает
+    элемент с индексом @c i без проверки индекса.
+    */
+    template <class Derived>
+    class vector_expression
+    {
+    public:
+        /** @brief Доступ к объекту-наследнику
+        @return Ссылка на <tt> *this </tt>, приведённая к типу наследника
+        */
+        Derived const & derived() const
+        {
+            return static_cast<Derived const &>(*this);
+        }
+
+    protected:
+        ~vector_expression() = default;
+    };
+
+    /** @brief Класс-характеристика для определения, является ли тип векторным выражением
+    @tparam T тип
+    */
+    template <class T>
+    struct is_vector_expression
+     : std::is_base_of<vector_expression<T>, T>
+    {};
+
+    /** @brief Тип, используемый для хранения аргумента выражения
+    @tparam E тип аргумента, выведенный для передаваемой ссылки
+    */
+    template <class E>
+    using vector_operand_t = std::conditional_t<std::is_lvalue_reference<E>::value,
+                                                std::decay_t<E> const &, std::decay_t<E>>;
+
+namespace details
+{
+    // Распределитель памяти первого из аргументов, у которого он есть
+    template <class X, class Y>
+    auto first_allocator(X const & x, Y const &, int)
+    -> decltype(x.get_allocator())
+    {
+        return x.get_allocator();
+    }
+
+    template <class X, class Y>
+    auto first_allocator(X const &, Y const & y, long)
+    -> decltype(y.get_allocator())
+    {
+        return y.get_allocator();
+    }
+
+    // Распределитель типа Alloc, построенный по распределителю выражения, если это возможно
+    template <class Alloc, class E>
+    auto allocator_for(E const & expr, int)
+    -> decltype(Alloc(expr.get_allocator()))
+    {
+        return Alloc(expr.get_allocator());
+    }
+
+    template <class Alloc, class E>
+    Alloc allocator_for(E const &, long)
+    {
+        return Alloc();
+    }
+}
+// namespace details
+
+    /** @brief Итератор для последовательного чтения элементов векторного выражения
+    @tparam Expression тип выражения
+
+    Итератор хранит указатель на выражение и индекс текущего элемента, а при разыменовании
+    вычисляет элемент с помощью <tt> Expression::element </tt> и возвращает его по значению.
+    Поэтому итератор является итератором ввода, хотя и поддерживает доступ по смещению
+    <tt> it[n] </tt>. Благодаря этому выражения можно передавать функциям, которые обрабатывают
+    векторы с помощью итераторов, например, <tt> symmetric_matrix::rank_one_update </tt>.
+    */
+    template <class Expression>
+    class vector_expression_iterator
+    {
+    public:
+        // Типы
+        /// @brief Категория итератора
+        using iterator_category = std::input_iterator_tag;
+
+        /// @brief Тип значения
+        using value_type = typename Expression::value_type;
+
+        /// @brief Тип расстояния
+        using difference_type = typename Expression::dimension_type;
+
+        /// @brief Тип ссылки
+        using reference = value_type;
+
+        /// @brief Тип указателя
+        using pointer = void;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param expr выражение
+        @param index индекс элемента
+        */
+        vector_expression_iterator(Expression const & expr, difference_type index)
+         : expr_(&expr)
+         , index_(index)
+        {}
+
+        // Доступ к элементам
+        /** @brief Значение текущего элемента
+        @return Значение элемента выражения, на который ссылается итератор
+        */
+        reference operator*() const
+        {
+            return this->expr_->element(this->index_);
+        }
+
+        /** @brief Доступ к элементу по смещению
+        @param n смещение
+        @return Значение элемента выражения с индексом, большим текущего на @c n
+        */
+        reference operator[](difference_type n) const
+        {
+            return this->expr_->element(this->index_ + n);
+        }
+
+        // Перемещение
+        /** @brief Переход к следующему элементу
+        @return <tt> *this </tt>
+        */
+        vector_expression_iterator & operator++()
+        {
+            ++ this->index_;
+            return *this;
+        }
+
+        /** @brief Переход к следующему элементу
+        @return Копия значения итератора до перехода
+        */
+        vector_expression_iterator operator++(int)
+        {
+            auto result = *this;
+            ++ *this;
+            return result;
+        }
+
+        // Сравнение
+        //@{
+        /** @brief Сравнение итераторов одного и того же выражения
+        @param x, y итераторы
+        @return Результат сравнения индексов элементов, на которые ссылаются итераторы
+        */
+        friend bool operator==(vector_expression_iterator const & x,
+                               vector_expression_iterator const & y)
+        {
+            return x.index_ == y.index_;
+        }
+
+        friend bool operator!=(vector_expression_iterator const & x,
+                               vector_expression_iterator const & y)
+        {
+            return !(x == y);
+        }
+        //@}
+
+    private:
+        Expression const * expr_;
+        difference_type index_;
+    };
+
+    /** @brief Поэлементная бинарная операция над двумя векторами
+    @tparam Operation тип бинарной операции
+    @tparam E1, E2 типы, используемые для хранения аргументов
+    */
+    template <class Operation, class E1, class E2>
+    class vector_binary_expression
+     : public vector_expression<vector_binary_expression<Operation, E1, E2>>
+    {
+        using Arg1 = std::decay_t<E1>;
+        using Arg2 = std::decay_t<E2>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::decay_t<decltype(std::declval<Operation>()(
+                                std::declval<typename Arg1::value_type const &>(),
+                                std::declval<typename Arg2::value_type const &>()))>;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = typename Arg1::checking_policy;
+
+        /// @brief Тип размерности и индексов
+        using dimension_type = typename Arg1::dimension_type;
+
+        /// @brief Тип константного итератора
+        using const_iterator = vector_expression_iterator<vector_binary_expression>;
+
+        /// @brief Тип итератора
+        using iterator = const_iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param x, y аргументы
+        @throw То же, что <tt> checking_policy::check_equal_dimensions(x, y) </tt>
+        */
+        template <class X, class Y>
+        vector_binary_expression(X && x, Y && y)
+         : x_(std::forward<X>(x))
+         , y_(std::forward<Y>(y))
+        {
+            checking_policy::check_equal_dimensions(this->x_, this->y_);
+        }
+
+        // Размер
+        /** @brief Размерность
+        @return Размерность аргументов выражения
+        */
+        dimension_type dim() const
+        {
+            return this->x_.dim();
+        }
+
+        // Доступ к элементам
+        /** @brief Доступ к элементу по индексу
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Значение элемента с индексом @c index
+        */
+        value_type operator[](dimension_type index) const
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Значение элемента с индексом @c index
+        */
+        value_type element(dimension_type index) const
+        {
+            return Operation{}(this->x_.element(index), this->y_.element(index));
+        }
+
+        // Итераторы
+        /** @brief Итератор начала последовательности элементов
+        @return Итератор, ссылающийся на элемент с индексом 0
+        */
+        const_iterator begin() const
+        {
+            return const_iterator(*this, 0);
+        }
+
+        /** @brief Итератор конца последовательности элементов
+        @return Итератор, ссылающийся на позицию после последнего элемента
+        */
+        const_iterator end() const
+        {
+            return const_iterator(*this, this->dim());
+        }
+
+        // Распределитель памяти
+        /** @brief Распределитель памяти аргументов
+        @return Распределитель памяти первого аргумента, у которого есть функция-член
+        @c get_allocator
+        */
+        template <class X = Arg1>
+        auto get_allocator() const
+        -> decltype(details::first_allocator(std::declval<X const &>(),
+                                             std::declval<Arg2 const &>(), 0))
+        {
+            return details::first_allocator(this->x_, this->y_, 0);
+        }
+
+    private:
+        E1 x_;
+        E2 y_;
+    };
+
+    /** @brief Поэлементная бинарная операция над вектором и скаляром
+    @tparam Operation тип бинарной операции
+    @tparam E тип, используемый для хранения вектора
+    @tparam Scalar тип скаляра
+    */
+    template <class Operation, class E, class Scalar>
+    class vector_scalar_expression
+     : public vector_expression<vector_scalar_expression<Operation, E, Scalar>>
+    {
+        using Arg = std::decay_t<E>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::decay_t<decltype(std::declval<Operation>()(
+                                std::declval<typename Arg::value_type const &>(),
+                                std::declval<Scalar const &>()))>;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = typename Arg::checking_policy;
+
+        /// @brief Тип размерности и индексов
+        using dimension_type = typename Arg::dimension_type;
+
+        /// @brief Тип константного итератора
+        using const_iterator = vector_expression_iterator<vector_scalar_expression>;
+
+        /// @brief Тип итератора
+        using iterator = const_iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param x вектор
+        @param a скаляр
+        */
+        template <class X>
+        vector_scalar_expression(X && x, Scalar a)
+         : x_(std::forward<X>(x))
+         , a_(std::move(a))
+        {}
+
+        // Размер
+        /** @brief Размерность
+        @return Размерность векторного аргумента выражения
+        */
+        dimension_type dim() const
+        {
+            return this->x_.dim();
+        }
+
+        // Доступ к элементам
+        /** @brief Доступ к элементу по индексу
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Значение элемента с индексом @c index
+        */
+        value_type operator[](dimension_type index) const
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Значение элемента с индексом @c index
+        */
+        value_type element(dimension_type index) const
+        {
+            return Operation{}(this->x_.element(index), this->a_);
+        }
+
+        // Итераторы
+        /** @brief Итератор начала последовательности элементов
+        @return Итератор, ссылающийся на элемент с индексом 0
+        */
+        const_iterator begin() const
+        {
+            return const_iterator(*this, 0);
+        }
+
+        /** @brief Итератор конца последовательности элементов
+        @return Итератор, ссылающийся на позицию после последнего элемента
+        */
+        const_iterator end() const
+        {
+            return const_iterator(*this, this->dim());
+        }
+
+        // Распределитель памяти
+        /** @brief Распределитель памяти векторного аргумента
+        @return <tt> x.get_allocator() </tt>, где @c x --- векторный аргумент
+        */
+        template <class X = Arg>
+        auto get_allocator() const
+        -> decltype(std::declval<X const &>().get_allocator())
+        {
+            return this->x_.get_allocator();
+        }
+
+    private:
+        E x_;
+        Scalar a_;
+    };
+
+    /** @brief Поэлементная бинарная операция над скаляром и вектором
+    @tparam Operation тип бинарной операции
+    @tparam Scalar тип скаляра
+    @tparam E тип, используемый для хранения вектора
+    */
+    template <class Operation, class Scalar, class E>
+    class scalar_vector_expression
+     : public vector_expression<scalar_vector_expression<Operation, Scalar, E>>
+    {
+        using Arg = std::decay_t<E>;
+
+    public:
+        // Типы
+        /// @brief Тип элементов
+        using value_type = std::decay_t<decltype(std::declval<Operation>()(
+                                std::declval<Scalar const &>(),
+                                std::declval<typename Arg::value_type const &>()))>;
+
+        /// @brief Стратегия проверки и обработки ошибок
+        using checking_policy = typename Arg::checking_policy;
+
+        /// @brief Тип размерности и индексов
+        using dimension_type = typename Arg::dimension_type;
+
+        /// @brief Тип константного итератора
+        using const_iterator = vector_expression_iterator<scalar_vector_expression>;
+
+        /// @brief Тип итератора
+        using iterator = const_iterator;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param a скаляр
+        @param x вектор
+        */
+        template <class X>
+        scalar_vector_expression(Scalar a, X && x)
+         : a_(std::move(a))
+         , x_(std::forward<X>(x))
+        {}
+
+        // Размер
+        /** @brief Размерность
+        @return Размерность векторного аргумента выражения
+        */
+        dimension_type dim() const
+        {
+            return this->x_.dim();
+        }
+
+        // Доступ к элементам
+        /** @brief Доступ к элементу по индексу
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Значение элемента с индексом @c index
+        */
+        value_type operator[](dimension_type index) const
+        {
+            checking_policy::check_index(*this, index);
+
+            return this->element(index);
+        }
+
+        /** @brief Доступ к элементу по индексу без проверки индекса
+        @param index индекс элемента
+        @pre <tt> 0 <= index && index < this->dim() </tt>
+        @return Значение элемента с индексом @c index
+        */
+        value_type element(dimension_type index) const
+        {
+            return Operation{}(this->a_, this->x_.element(index));
+        }
+
+        // Итераторы
+        /** @brief Итератор начала последовательности элементов
+        @return Итератор, ссылающийся на элемент с индексом 0
+        */
+        const_iterator begin() const
+        {
+            return const_iterator(*this, 0);
+        }
+
+        /** @brief Итератор конца последовательности элементов
+        @return Итератор, ссылающийся на позицию после последнего элемента
+        */
+        const_iterator end() const
+        {
+            return const_iterator(*this, this->dim());
+        }
+
+        // Распределитель памяти
+        /** @brief Распределитель памяти векторного аргумента
+        @return <tt> x.get_allocator() </tt>, где @c x --- векторный аргумент
+        */
+        template <class X = Arg>
+        auto get_allocator() const
+        -> decltype(std::declval<X const &>().get_allocator())
+        {
+            return this->x_.get_allocator();
+        }
+
+    private:
+        Scalar a_;
+        E x_;
+    };
+
+namespace details
+{
+    template <class E1, class E2>
+    using enable_if_vectors_t
+        = std::enable_if_t<is_vector_expression<std::decay_t<E1>>::value
+                           && is_vector_expression<std::decay_t<E2>>::value>;
+
+    template <class E, class Scalar>
+    using enable_if_vector_and_scalar_t
+        = std::enable_if_t<is_vector_expression<std::decay_t<E>>::value
+                           && !is_vector_expression<std::decay_t<Scalar>>::value>;
+
+    // Тип параметра, который не участвует в выводе аргументов шаблона
+    template <class T>
+    struct non_deduced
+    {
+        using type = T;
+    };
+
+    template <class T>
+    using non_deduced_t = typename non_deduced<T>::type;
+}
+// namespace details
+
+    /** @brief Оператор "равно"
+    @param x, y аргументы
+    @return @c true, если равны размерности векторов и все их соответствующие элементы, иначе
+    --- @b false.
+    */
+    template <class E1, class E2>
+    bool operator==(vector_expression<E1> const & x, vector_expression<E2> const & y)
+    {
+        auto const & x_ref = x.derived();
+        auto const & y_ref = y.derived();
+
+        if(x_ref.dim() != y_ref.dim())
+        {
+            return false;
+        }
+
+        for(auto i = 0*x_ref.dim(); i != x_ref.dim(); ++ i)
+        {
+            if(!(x_ref.element(i) == y_ref.element(i)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /** @brief Оператор "не равно"
+    @param x, y аргументы
+    @return <tt> !(x == y) </tt>
+    */
+    template <class E1, class E2>
+    bool operator!=(vector_expression<E1> const & x, vector_expression<E2> const & y)
+    {
+        return !(x == y);
+    }
+
+    /** @brief Оператор умножения вектора на скаляр
+    @param x вектор
+    @param a скаляр
+    @return Выражение, элементы которого имеют вид <tt> x[i] * a </tt>, где
+    <tt> 0 <= i && i < x.dim() </tt>
+    */
+    template <class E, class Scalar, class = details::enable_if_vector_and_scalar_t<E, Scalar>>
+    vector_scalar_expression<std::multiplies<>, vector_operand_t<E>, Scalar>
+    operator*(E && x, Scalar const & a)
+    {
+        return {std::forward<E>(x), a};
+    }
+
+    /** @brief Оператор умножения скаляра на вектор
+    @param a скаляр
+    @param x вектор
+    @return Выражение, элементы которого имеют вид <tt> a * x[i] </tt>, где
+    <tt> 0 <= i && i < x.dim() </tt>
+    */
+    template <class Scalar, class E, class = details::enable_if_vector_and_scalar_t<E, Scalar>>
+    scalar_vector_expression<std::multiplies<>, Scalar, vector_operand_t<E>>
+    operator*(Scalar const & a, E && x)
+    {
+        return {a, std::forward<E>(x)};
+    }
+
+    /** @brief Оператор деления вектора на скаляр
+    @param x вектор
+    @param a скаляр
+    @pre <tt> a != 0 </tt>
+    @return Выражение, элементы которого равны соответствующим элементам @c x, делённым на @c a
+    @throw То же, что <tt> checking_policy::check_divisor_is_not_zero(a) </tt>
+    */
+    template <class E, class Scalar, class = details::enable_if_vector_and_scalar_t<E, Scalar>>
+    vector_scalar_expression<std::divides<>, vector_operand_t<E>, Scalar>
+    operator/(E && x, Scalar const & a)
+    {
+        std::decay_t<E>::checking_policy::check_divisor_is_not_zero(a);
+
+        return {std::forward<E>(x), a};
+    }
+
+    /** @brief Оператор сложения векторов
+    @param x, y аргументы
+    @pre <tt> x.dim() == y.dim() </tt>
+    @return Выражение, элементы которого равны сумме соответствующих элементов векторов @c x и
+    @c y
+    @throw То же, что <tt> checking_policy::check_equal_dimensions(x, y) </tt>
+    */
+    template <class E1, class E2, class = details::enable_if_vectors_t<E1, E2>>
+    vector_binary_expression<std::plus<>, vector_operand_t<E1>, vector_operand_t<E2>>
+    operator+(E1 && x, E2 && y)
+    {
+        return {std::forward<E1>(x), std::forward<E2>(y)};
+    }
+
+    /** @brief Оператор разности векторов
+    @param x, y аргументы
+    @pre <tt> x.dim() == y.dim() </tt>
+    @return Выражение, элементы которого равны разности соответствующих элементов векторов @c x
+    и @c y
+    @throw То же, что <tt> checking_policy::check_equal_dimensions(x, y) </tt>
+    */
+    template <class E1, class E2, class = details::enable_if_vectors_t<E1, E2>>
+    vector_binary_expression<std::minus<>, vector_operand_t<E1>, vector_operand_t<E2>>
+    operator-(E1 && x, E2 && y)
+    {
+        return {std::forward<E1>(x), std::forward<E2>(y)};
+    }
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_LINEAR_ALGEBRA_VECTOR_EXPRESSION_HPP_INCLUDED
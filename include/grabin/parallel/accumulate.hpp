@@ -0,0 +1,381 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_PARALLEL_ACCUMULATE_HPP_INCLUDED
+#define Z_GRABIN_PARALLEL_ACCUMULATE_HPP_INCLUDED
+
+/** @file grabin/parallel/accumulate.hpp
+ @brief Параллельное накопление статистик
+*/
+
+#include <grabin/parallel/thread_pool.hpp>
+
+#include <atomic>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /// @brief Параметры параллельного накопления
+    struct parallel_options
+    {
+        /** @brief Количество потоков, если оно равно нулю, то используется
+        <tt> std::thread::hardware_concurrency() </tt>. Игнорируется, если задан пул потоков.
+        */
+        std::size_t threads = 0;
+
+        /** @brief Количество элементов, обрабатываемых как единое целое, если оно равно нулю, то
+        выбирается автоматически
+        */
+        std::size_t grain_size = 0;
+
+        /** @brief Если @c true, то элементы распределяются между потоками статически, а частичные
+        результаты объединяются в порядке следования элементов, так что при одинаковом количестве
+        потоков результат не зависит от планирования потоков.
+        */
+        bool deterministic = false;
+
+        /** @brief Если @c true, то результат не зависит ни от планирования, ни от количества
+        потоков. Интервал разбивается на порции, размер которых не зависит от количества потоков
+        (по умолчанию &mdash; 1024 элемента), каждая порция обрабатывается отдельной копией
+        накопителя-образца, а частичные результаты объединяются по фиксированному дереву попарного
+        объединения, которое определяется только количеством порций. Имеет приоритет над
+        @c deterministic.
+        */
+        bool reproducible = false;
+
+        /** @brief Пул потоков, если равен @c nullptr, то создаётся временный пул. Если функция
+        вызвана из задачи, выполняемой потоком этого пула, то все её задачи выполняются в текущем
+        потоке, так как ожидание задач в очереди пула могло бы привести к взаимной блокировке.
+        */
+        thread_pool * pool = nullptr;
+    };
+
+    /// @brief Функциональный объект, передающий элемент накопителю
+    struct accumulator_update
+    {
+        /** @brief Оператор вызова
+        @param acc накопитель
+        @param x элемент
+        @return <tt> acc(x) </tt>
+        */
+        template <class Accumulator, class T>
+        void operator()(Accumulator & acc, T const & x) const
+        {
+            acc(x);
+        }
+    };
+
+namespace details
+{
+    // Помещение в стек накопителя, объединяющего 2^level порций; накопители с одинаковым
+    // количеством порций объединяются, как при увеличении двоичного счётчика
+    template <class Accumulator>
+    void push_pairwise(std::vector<std::pair<Accumulator, std::size_t>> & stack,
+                       Accumulator acc, std::size_t level)
+    {
+        stack.emplace_back(std::move(acc), level);
+
+        while(stack.size() >= 2 && stack[stack.size() - 2].second == stack.back().second)
+        {
+            auto & lower = stack[stack.size() - 2];
+
+            lower.first.merge(stack.back().first);
+            ++ lower.second;
+
+            stack.pop_back();
+        }
+    }
+
+    // Объединение накопителей стека, начиная с последних (наименьших)
+    template <class Accumulator>
+    Accumulator fold_pairwise(std::vector<std::pair<Accumulator, std::size_t>> & stack)
+    {
+        auto result = std::move(stack.back().first);
+
+        for(auto i = stack.size() - 1; i > 0; -- i)
+        {
+            auto partial = std::move(stack[i - 1].first);
+            partial.merge(result);
+            result = std::move(partial);
+        }
+
+        return result;
+    }
+
+    /* Порции объединяются в группы по 2^k порций так, чтобы групп было не больше max_groups.
+    Группы распределяются между потоками динамически, порции группы объединяются по схеме
+    попарного суммирования, а затем стеки групп по порядку помещаются в общий стек. Так как
+    границы групп кратны их размеру, дерево объединения совпадает с деревом, которое получилось бы
+    при последовательной обработке всех порций одним стеком, то есть зависит только от количества
+    порций.
+    */
+    template <class RandomAccessIterator, class Accumulator, class Update>
+    Accumulator reproducible_accumulate(thread_pool & pool,
+                                        RandomAccessIterator first, RandomAccessIterator last,
+                                        Accumulator const & init, Update const & update,
+                                        parallel_options const & options)
+    {
+        using Stack = std::vector<std::pair<Accumulator, std::size_t>>;
+
+        auto const max_groups = std::size_t{256};
+
+        auto const size = static_cast<std::size_t>(last - first);
+        auto const grain = options.grain_size != 0 ? options.grain_size : std::size_t{1024};
+        auto const chunks = (size + grain - 1) / grain;
+
+        auto group_size = std::size_t{1};
+
+        while((chunks + group_size - 1) / group_size > max_groups)
+        {
+            group_size *= 2;
+        }
+
+        auto const groups = (chunks + group_size - 1) / group_size;
+
+        std::vector<Stack> partials(groups);
+        std::vector<std::future<void>> results;
+
+        auto const tasks = std::min(pool.size(), groups);
+        results.reserve(tasks);
+
+        std::atomic<std::size_t> next_group{0};
+
+        for(auto task = std::size_t{0}; task < tasks; ++ task)
+        {
+            results.push_back(pool.submit_or_run([&]
+            {
+                for(;;)
+                {
+                    auto const group = next_group++;
+
+                    if(group >= groups)
+                    {
+                        break;
+                    }
+
+                    auto const chunk_last = std::min(chunks, (group + 1) * group_size);
+
+                    for(auto chunk = group * group_size; chunk != chunk_last; ++ chunk)
+                    {
+                        auto acc = init;
+
+                        auto const pos_last = first + std::min(size, (chunk + 1) * grain);
+
+                        for(auto pos = first + chunk * grain; pos != pos_last; ++ pos)
+                        {
+                            update(acc, *pos);
+                        }
+
+                        details::push_pairwise(partials[group], std::move(acc), 0);
+                    }
+                }
+            }));
+        }
+
+        // Нельзя выходить из функции, пока задачи используют её локальные переменные
+        for(auto & result : results)
+        {
+            result.wait();
+        }
+
+        for(auto & result : results)
+        {
+            result.get();
+        }
+
+        Stack stack;
+
+        for(auto & partial : partials)
+        {
+            for(auto & item : partial)
+            {
+                details::push_pairwise(stack, std::move(item.first), item.second);
+            }
+        }
+
+        return details::fold_pairwise(stack);
+    }
+
+    template <class RandomAccessIterator, class Accumulator, class Update>
+    Accumulator parallel_accumulate(thread_pool & pool,
+                                    RandomAccessIterator first, RandomAccessIterator last,
+                                    Accumulator const & init, Update const & update,
+                                    parallel_options const & options)
+    {
+        if(options.reproducible)
+        {
+            return details::reproducible_accumulate(pool, first, last, init, update, options);
+        }
+
+        auto const size = static_cast<std::size_t>(last - first);
+        auto const workers = pool.size();
+
+        auto const grain = options.grain_size != 0
+                         ? options.grain_size
+                         : std::max(std::size_t{1}, size / (workers * 8));
+
+        auto const chunks = (size + grain - 1) / grain;
+
+        auto const process = [&](Accumulator & acc, std::size_t chunk)
+        {
+            auto const chunk_first = first + chunk * grain;
+            auto const chunk_last = first + std::min(size, (chunk + 1) * grain);
+
+            for(auto pos = chunk_first; pos != chunk_last; ++ pos)
+            {
+                update(acc, *pos);
+            }
+        };
+
+        auto const tasks = std::min(workers, chunks);
+
+        std::vector<Accumulator> partials(tasks, init);
+        std::vector<std::future<void>> results;
+        results.reserve(tasks);
+
+        std::atomic<std::size_t> next_chunk{0};
+
+        for(auto task = std::size_t{0}; task < tasks; ++ task)
+        {
+            if(options.deterministic)
+            {
+                // Каждая задача обрабатывает непрерывную последовательность порций
+                results.push_back(pool.submit_or_run([&, task]
+                {
+                    auto const chunk_first = chunks * task / tasks;
+                    auto const chunk_last = chunks * (task + 1) / tasks;
+
+                    for(auto chunk = chunk_first; chunk != chunk_last; ++ chunk)
+                    {
+                        process(partials[task], chunk);
+                    }
+                }));
+            }
+            else
+            {
+                // Порции распределяются динамически для балансировки нагрузки
+                results.push_back(pool.submit_or_run([&, task]
+                {
+                    for(;;)
+                    {
+                        auto const chunk = next_chunk++;
+
+                        if(chunk >= chunks)
+                        {
+                            break;
+                        }
+
+                        process(partials[task], chunk);
+                    }
+                }));
+            }
+        }
+
+        // Нельзя выходить из функции, пока задачи используют её локальные переменные
+        for(auto & result : results)
+        {
+            result.wait();
+        }
+
+        for(auto & result : results)
+        {
+            result.get();
+        }
+
+        auto acc = init;
+
+        for(auto const & partial : partials)
+        {
+            acc.merge(partial);
+        }
+
+        return acc;
+    }
+}
+// namespace details
+
+    /** @brief Параллельное накопление статистик
+    @param first, last интервал, задающий последовательность элементов
+    @param init накопитель-образец, копии которого используются для накопления частичных
+    результатов
+    @param update функциональный объект, такой что <tt> update(acc, x) </tt> учитывает элемент
+    @c x в накопителе @c acc
+    @param options параметры распараллеливания
+    @pre @c init является нейтральным элементом относительно операции @c merge, например,
+    накопителем, который ещё не обработал ни одного элемента
+    @return Накопитель, состояние которого совпадает (с точностью до ошибок округления) с
+    состоянием копии @c init, к которой последовательно применили @c update со всеми элементами
+    <tt> [first; last) </tt>
+
+    Интервал разбивается на порции по <tt> options.grain_size </tt> элементов, порции
+    обрабатываются потоками пула, а частичные результаты объединяются с помощью функции-члена
+    @c merge накопителя.
+
+    Если <tt> options.reproducible </tt>, то результат побитово совпадает с результатом
+    последовательного накопления с помощью <tt> pairwise_accumulator(init, grain) </tt>, где
+    @c grain &mdash; размер порции, при любом количестве потоков. За это приходится платить
+    одним объединением накопителей на порцию и хранением не более 256 стеков частичных
+    результатов.
+    */
+    template <class RandomAccessIterator, class Accumulator, class Update>
+    Accumulator parallel_accumulate(RandomAccessIterator first, RandomAccessIterator last,
+                                    Accumulator init, Update update,
+                                    parallel_options const & options = parallel_options())
+    {
+        static_assert(std::is_base_of<std::random_access_iterator_tag,
+                                      typename std::iterator_traits<RandomAccessIterator>::iterator_category>::value,
+                      "parallel_accumulate requires random access iterators");
+
+        if(first == last)
+        {
+            return init;
+        }
+
+        if(options.pool != nullptr)
+        {
+            return details::parallel_accumulate(*options.pool, first, last, init, update, options);
+        }
+        else
+        {
+            thread_pool pool(options.threads);
+            return details::parallel_accumulate(pool, first, last, init, update, options);
+        }
+    }
+
+    /** @brief Параллельное накопление статистик
+    @param first, last интервал, задающий последовательность элементов
+    @param init накопитель-образец
+    @param options параметры распараллеливания
+    @return <tt> parallel_accumulate(first, last, std::move(init), accumulator_update{}, options) </tt>
+    */
+    template <class RandomAccessIterator, class Accumulator>
+    Accumulator parallel_accumulate(RandomAccessIterator first, RandomAccessIterator last,
+                                    Accumulator init,
+                                    parallel_options const & options = parallel_options())
+    {
+        return ::grabin::parallel_accumulate(first, last, std::move(init), accumulator_update{},
+                                             options);
+    }
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_PARALLEL_ACCUMULATE_HPP_INCLUDED
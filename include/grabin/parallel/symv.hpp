@@ -0,0 +1,182 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_PARALLEL_SYMV_HPP_INCLUDED
+#define Z_GRABIN_PARALLEL_SYMV_HPP_INCLUDED
+
+/** @file grabin/parallel/symv.hpp
+ @brief Параллельное произведение симметричной матрицы на вектор
+*/
+
+#include <grabin/linear_algebra/blas.hpp>
+#include <grabin/parallel/accumulate.hpp>
+
+namespace grabin
+{
+inline namespace v0
+{
+namespace details
+{
+    // Границы полос строк, содержащих примерно одинаковое количество элементов треугольника
+    template <class Dimension>
+    std::vector<Dimension> triangle_row_bands(Dimension n, std::size_t bands)
+    {
+        std::vector<Dimension> result;
+        result.reserve(bands + 1);
+        result.push_back(0);
+
+        auto const total = n * (n + 1) / 2;
+        auto row = Dimension{0};
+
+        for(auto band = std::size_t{1}; band < bands; ++ band)
+        {
+            auto const elements = total * Dimension(band) / Dimension(bands);
+
+            while(row < n && row * (row + 1) / 2 < elements)
+            {
+                ++ row;
+            }
+
+            result.push_back(row);
+        }
+
+        result.push_back(n);
+
+        return result;
+    }
+
+    template <class Matrix, class Vector>
+    void parallel_symv(thread_pool & pool, std::size_t tasks,
+                       typename Matrix::value_type const & alpha, Matrix const & A,
+                       typename Matrix::value_type const * x, Vector & y)
+    {
+        using T = typename Matrix::value_type;
+
+        auto const bands = details::triangle_row_bands(A.dim(), tasks);
+
+        // Строки полосы дают вклад только в элементы y с меньшими номерами, поэтому каждой задаче
+        // достаточно вектора длины, равной концу её полосы
+        std::vector<std::vector<T>> partials(tasks);
+        std::vector<std::future<void>> results;
+        results.reserve(tasks);
+
+        for(auto task = std::size_t{0}; task < tasks; ++ task)
+        {
+            results.push_back(pool.submit_or_run([&, task]
+            {
+                auto & z = partials[task];
+                z.assign(static_cast<std::size_t>(bands[task + 1]), T(0));
+
+                details::symv_rows(alpha, A, x, z.data(), bands[task], bands[task + 1]);
+            }));
+        }
+
+        // Нельзя выходить из функции, пока задачи используют её локальные переменные
+        for(auto & result : results)
+        {
+            result.wait();
+        }
+
+        for(auto & result : results)
+        {
+            result.get();
+        }
+
+        auto const y_first = y.begin();
+
+        for(auto const & z : partials)
+        {
+            for(auto i = std::size_t{0}; i != z.size(); ++ i)
+            {
+                y_first[i] += z[i];
+            }
+        }
+    }
+}
+// namespace details
+
+    /** @brief Параллельное произведение симметричной матрицы на вектор
+    @param alpha множитель произведения
+    @param A симметричная матрица
+    @param x вектор
+    @param beta множитель вектора @c y
+    @param y изменяемый вектор или представление
+    @param options параметры распараллеливания, <tt> options.grain_size </tt> задаёт минимальное
+    количество элементов треугольника на одну задачу (по умолчанию &mdash; 65536)
+    @pre @c x и @c y не перекрываются
+    @post <tt> y = alpha * A * x + beta * y </tt>
+    @throw То же, что <tt> symv(alpha, A, x, beta, y) </tt>
+
+    Строки треугольника делятся на полосы с примерно одинаковым количеством элементов, каждая
+    полоса обрабатывается отдельной задачей в собственный вектор, после чего эти векторы
+    прибавляются к @c y в порядке следования полос. Поэтому при одинаковом количестве задач
+    результат не зависит от планирования потоков, но может отличаться от результата @c symv
+    ошибками округления. Если матрица слишком мала для нескольких задач, то вызывается @c symv.
+
+    Если <tt> options.reproducible </tt>, то количество полос определяется только размерностью
+    матрицы и <tt> options.grain_size </tt> (но не превосходит 64), а не количеством потоков,
+    поэтому результат побитово совпадает при любом количестве потоков.
+
+    Если функция вызвана из задачи, выполняемой потоком пула <tt> options.pool </tt>, то полосы
+    обрабатываются в текущем потоке (см. <tt> thread_pool::submit_or_run </tt>).
+    */
+    template <class Matrix, class Vector1, class Vector2>
+    void parallel_symv(typename Matrix::value_type const & alpha, Matrix const & A,
+                       Vector1 const & x, typename Matrix::value_type const & beta, Vector2 && y,
+                       parallel_options const & options = parallel_options())
+    {
+        using T = typename Matrix::value_type;
+        using Checking = typename Matrix::checking_policy;
+
+        Checking::check_equal_dimensions(A, x);
+        Checking::check_equal_dimensions(A, y);
+
+        auto const workers = options.pool != nullptr ? options.pool->size()
+                           : options.threads != 0 ? options.threads
+                           : std::max(std::size_t{1},
+                                      std::size_t{std::thread::hardware_concurrency()});
+
+        auto const grain = options.grain_size != 0 ? options.grain_size : std::size_t{1} << 16;
+        auto const n = static_cast<std::size_t>(A.dim());
+        auto const max_bands = options.reproducible ? std::size_t{64} : workers;
+        auto const tasks = std::min(max_bands, n * (n + 1) / 2 / grain);
+
+        if(tasks <= 1 || alpha == T(0))
+        {
+            return ::grabin::symv(alpha, A, x, beta, y);
+        }
+
+        details::scale_vector(beta, y);
+
+        std::vector<T> x_buffer;
+        auto const x_data = details::contiguous_elements(x, x_buffer, 0);
+
+        if(options.pool != nullptr)
+        {
+            details::parallel_symv(*options.pool, tasks, alpha, A, x_data, y);
+        }
+        else
+        {
+            thread_pool pool(workers);
+            details::parallel_symv(pool, tasks, alpha, A, x_data, y);
+        }
+    }
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_PARALLEL_SYMV_HPP_INCLUDED
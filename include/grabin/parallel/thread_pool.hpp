@@ -0,0 +1,213 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_PARALLEL_THREAD_POOL_HPP_INCLUDED
+#define Z_GRABIN_PARALLEL_THREAD_POOL_HPP_INCLUDED
+
+/** @file grabin/parallel/thread_pool.hpp
+ @brief Пул потоков
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Пул потоков фиксированного размера
+    Задачи выполняются в порядке поступления. Деструктор дожидается выполнения всех поставленных в
+    очередь задач.
+    */
+    class thread_pool
+    {
+    public:
+        // Типы
+        /// @brief Тип для представления количества потоков
+        using size_type = std::size_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param threads количество потоков, если оно равно нулю, то используется
+        <tt> std::thread::hardware_concurrency() </tt>
+        @post <tt> this->size() > 0 </tt>
+        @throw std::system_error, если не удалось запустить поток; уже запущенные потоки при этом
+        завершаются
+        */
+        explicit thread_pool(size_type threads = 0)
+        {
+            if(threads == 0)
+            {
+                threads = std::max(size_type{1}, size_type{std::thread::hardware_concurrency()});
+            }
+
+            this->workers_.reserve(threads);
+
+            try
+            {
+                for(; threads > 0; -- threads)
+                {
+                    this->workers_.emplace_back([this] { this->run(); });
+                }
+            }
+            catch(...)
+            {
+                this->stop();
+                throw;
+            }
+        }
+
+        thread_pool(thread_pool const &) = delete;
+        thread_pool & operator=(thread_pool const &) = delete;
+
+        /// @brief Деструктор: дожидается выполнения всех задач и завершает потоки
+        ~thread_pool()
+        {
+            this->stop();
+        }
+
+        // Размер
+        /** @brief Количество потоков
+        @return Количество потоков, выполняющих задачи
+        */
+        size_type size() const
+        {
+            return this->workers_.size();
+        }
+
+        // Задачи
+        /** @brief Постановка задачи в очередь
+        @param f функциональный объект без аргументов
+        @return Объект @c std::future, через который можно получить результат вызова @c f или
+        выброшенное им исключение
+        */
+        template <class F>
+        std::future<std::result_of_t<F()>> submit(F f)
+        {
+            using Result = std::result_of_t<F()>;
+
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::move(f));
+            auto result = task->get_future();
+
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                this->tasks_.emplace([task] { (*task)(); });
+            }
+
+            this->condition_.notify_one();
+
+            return result;
+        }
+
+        /** @brief Выполнение задачи в пуле или, если вызов выполняется из потока пула, в
+        текущем потоке
+        @param f функциональный объект без аргументов
+        @return Объект @c std::future, через который можно получить результат вызова @c f или
+        выброшенное им исключение
+
+        Задача, выполняемая потоком пула, не должна дожидаться задач, поставленных ею в очередь того
+        же пула: если все потоки пула ждут, то поставленные задачи никогда не будут выполнены. Эта
+        функция вызывает @c f немедленно, если текущий поток принадлежит пулу, поэтому результат
+        можно ожидать без риска взаимной блокировки.
+        */
+        template <class F>
+        std::future<std::result_of_t<F()>> submit_or_run(F f)
+        {
+            if(!this->owns_current_thread())
+            {
+                return this->submit(std::move(f));
+            }
+
+            std::packaged_task<std::result_of_t<F()>()> task(std::move(f));
+            auto result = task.get_future();
+
+            task();
+
+            return result;
+        }
+
+        /** @brief Проверка, принадлежит ли пулу текущий поток
+        @return @c true, если функция вызвана из задачи, выполняемой потоком пула
+        */
+        bool owns_current_thread() const
+        {
+            auto const id = std::this_thread::get_id();
+
+            return std::any_of(this->workers_.begin(), this->workers_.end(),
+                               [id](std::thread const & worker) { return worker.get_id() == id; });
+        }
+
+    private:
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                this->stopped_ = true;
+            }
+
+            this->condition_.notify_all();
+
+            for(auto & worker : this->workers_)
+            {
+                worker.join();
+            }
+        }
+
+        void run()
+        {
+            for(;;)
+            {
+                std::function<void()> task;
+
+                {
+                    std::unique_lock<std::mutex> lock(this->mutex_);
+
+                    this->condition_.wait(lock, [this]
+                                          { return this->stopped_ || !this->tasks_.empty(); });
+
+                    if(this->tasks_.empty())
+                    {
+                        return;
+                    }
+
+                    task = std::move(this->tasks_.front());
+                    this->tasks_.pop();
+                }
+
+                task();
+            }
+        }
+
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        bool stopped_ = false;
+    };
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_PARALLEL_THREAD_POOL_HPP_INCLUDED
@@ -0,0 +1,343 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_STATISTICS_EWMA_HPP_INCLUDED
+#define Z_GRABIN_STATISTICS_EWMA_HPP_INCLUDED
+
+/** @file grabin/statistics/ewma.hpp
+ @brief Экспоненциально взвешенные скользящие среднее и дисперсия
+*/
+
+#include <grabin/statistics/mean.hpp>
+#include <grabin/linear_algebra/outer_product.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace grabin
+{
+inline namespace v0
+{
+namespace details
+{
+    template <class T, class = void>
+    struct ewma_weight
+    {
+        using type = T;
+    };
+
+    template <class T>
+    struct ewma_weight<T, decltype(std::declval<typename T::value_type>(), void())>
+    {
+        using type = typename T::value_type;
+    };
+
+    template <class T>
+    void check_smoothing_factor(T const & alpha)
+    {
+        if(!(alpha > T(0) && alpha <= T(1)))
+        {
+            throw std::logic_error("Smoothing factor must be in (0, 1]");
+        }
+    }
+}
+// namespace details
+
+    /** @brief Коэффициент сглаживания, соответствующий заданному периоду полураспада
+    @param half_life количество элементов, за которое вес элемента уменьшается вдвое
+    @return Такое @c alpha, что <tt> pow(1 - alpha, half_life) == 1/2 </tt>
+    @throw logic_error, если <tt> half_life <= 0 </tt>
+    */
+    template <class Real>
+    Real ewma_smoothing_factor(Real const & half_life)
+    {
+        if(!(half_life > Real(0)))
+        {
+            throw std::logic_error("Half-life must be positive");
+        }
+
+        using std::pow;
+        return Real(1) - pow(Real(2), -Real(1) / half_life);
+    }
+
+    /** @brief Накопитель для вычисления экспоненциально взвешенного скользящего среднего
+    @tparam T тип элементов
+    @tparam IntType тип для представления количества элементов
+
+    Первый элемент становится начальным значением среднего, каждый следующий элемент @c x
+    обновляет его по формуле <tt> mean += alpha * (x - mean) </tt>, где @c alpha --- коэффициент
+    сглаживания. Накопитель использует память постоянного объёма.
+    */
+    template <class T, class IntType = int>
+    class ewma_mean_accumulator
+    {
+    public:
+        /// @brief Тип количества элементов
+        using counter_type = IntType;
+
+        /// @brief Тип среднего
+        using mean_type = average_type_t<T, IntType>;
+
+        /// @brief Тип коэффициента сглаживания
+        using weight_type = typename details::ewma_weight<mean_type>::type;
+
+        /** @brief Конструктор
+        @param alpha коэффициент сглаживания, то есть вес нового элемента
+        @throw logic_error, если @c alpha не принадлежит <tt> (0; 1] </tt>
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == T(0) </tt>
+        @post <tt> this->smoothing_factor() == alpha </tt>
+        */
+        explicit ewma_mean_accumulator(weight_type const & alpha)
+         : alpha_(alpha)
+        {
+            details::check_smoothing_factor(alpha);
+        }
+
+        /** @brief Конструктор с явным заданием "нулевого" элемента
+        @param zero "нулевой" элемент
+        @param alpha коэффициент сглаживания, то есть вес нового элемента
+        @throw logic_error, если @c alpha не принадлежит <tt> (0; 1] </tt>
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == zero </tt>
+        @post <tt> this->smoothing_factor() == alpha </tt>
+        */
+        ewma_mean_accumulator(T zero, weight_type const & alpha)
+         : mean_(std::move(zero))
+         , alpha_(alpha)
+        {
+            details::check_smoothing_factor(alpha);
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param x новый элемент
+        @return <tt> *this </tt>
+        */
+        ewma_mean_accumulator & operator()(T const & x)
+        {
+            return this->update(x);
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новый элемент, например, представление данных, хранящихся во внешнем буфере
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+
+        Элемент учитывается без копирования в объект типа @c T.
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, ewma_mean_accumulator &>
+        operator()(Vector const & x)
+        {
+            return this->update(x);
+        }
+
+        /** @brief Вес, с которым будет учтён следующий элемент
+        @return @c 1, если элементов ещё не было, иначе <tt> this->smoothing_factor() </tt>
+        */
+        weight_type next_weight() const
+        {
+            return this->n_ == 0 ? weight_type(1) : this->alpha_;
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->n_;
+        }
+
+        /** @brief Среднее значение
+        @return Накопленное к настоящему моменту экспоненциально взвешенное среднее
+        */
+        mean_type const & mean() const
+        {
+            return this->mean_;
+        }
+
+        /** @brief Коэффициент сглаживания
+        @return Вес нового элемента, заданный при создании
+        */
+        weight_type const & smoothing_factor() const
+        {
+            return this->alpha_;
+        }
+
+    private:
+        template <class X>
+        ewma_mean_accumulator & update(X const & x)
+        {
+            ::grabin::update_mean(this->mean_, x, this->next_weight(), 1);
+
+            ++ this->n_;
+
+            return *this;
+        }
+
+        counter_type n_ = counter_type(0);
+        mean_type mean_ = mean_type(0);
+        weight_type alpha_;
+    };
+
+    /** @brief Накопитель для вычисления экспоненциально взвешенных скользящих среднего и
+    дисперсии (матрицы ковариаций для векторов)
+    @tparam T тип элементов
+    @tparam IntType тип для представления количества элементов
+    @tparam Tensor_algebra используемая тензорная алгебра
+
+    Для нового элемента @c x с отклонением <tt> d = x - mean </tt> от предыдущего среднего
+    дисперсия обновляется по формуле <tt> S = (1 - alpha) * (S + alpha * d * d) </tt>, где
+    * обозначает тензорное произведение. Получаемое значение совпадает со взвешенной дисперсией
+    относительно текущего среднего с теми же весами, что и у среднего. Для векторов размерности
+    @c p матрица ковариаций хранится в упакованном виде, обновление требует O(p^2) операций и
+    выполняется без создания временных объектов.
+    */
+    template <class T, class IntType = int,
+              template <class> class Tensor_algebra = default_tensor_algebra>
+    class ewma_variance_accumulator
+    {
+        using Mean_acc = ewma_mean_accumulator<T, IntType>;
+
+    public:
+        /// @brief Тип количества элементов
+        using counter_type = typename Mean_acc::counter_type;
+
+        /// @brief Тип среднего
+        using mean_type = typename Mean_acc::mean_type;
+
+        /// @brief Тип коэффициента сглаживания
+        using weight_type = typename Mean_acc::weight_type;
+
+        /// @brief Тип тензорной алгебры
+        using tensor_algebra = Tensor_algebra<mean_type>;
+
+        /// @brief Тип дисперсии
+        using variance_type = average_type_t<typename tensor_algebra::tensor_product_type, IntType>;
+
+        /** @brief Конструктор
+        @param alpha коэффициент сглаживания, то есть вес нового элемента
+        @throw logic_error, если @c alpha не принадлежит <tt> (0; 1] </tt>
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == T(0) </tt>
+        @post <tt> this->variance() == T(0) </tt>
+        */
+        explicit ewma_variance_accumulator(weight_type const & alpha)
+         : mean_acc_(alpha)
+        {}
+
+        /** @brief Конструктор
+        @param zero "нулевой" элемент
+        @param alpha коэффициент сглаживания, то есть вес нового элемента
+        @throw logic_error, если @c alpha не принадлежит <tt> (0; 1] </tt>
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == zero </tt>
+        @post <tt> this->variance() == zero * zero </tt>, где * обозначает тензорное произведение
+        */
+        ewma_variance_accumulator(mean_type zero, weight_type const & alpha)
+         : S_(tensor_algebra::outer_square_impl(zero))
+         , mean_acc_(std::move(zero), alpha)
+        {}
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param x новый элемент
+        @return <tt> *this </tt>
+        */
+        ewma_variance_accumulator & operator()(T const & x)
+        {
+            return this->update(x);
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новый элемент, например, представление данных, хранящихся во внешнем буфере
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+
+        Элемент учитывается без копирования в объект типа @c T.
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, ewma_variance_accumulator &>
+        operator()(Vector const & x)
+        {
+            return this->update(x);
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->mean_acc_.count();
+        }
+
+        /** @brief Среднее значение
+        @return Накопленное к настоящему моменту экспоненциально взвешенное среднее
+        */
+        mean_type const & mean() const
+        {
+            return this->mean_acc_.mean();
+        }
+
+        /** @brief Дисперсия
+        @return Накопленное к настоящему моменту значение экспоненциально взвешенной дисперсии
+        */
+        variance_type const & variance() const
+        {
+            return this->S_;
+        }
+
+        /** @brief Среднеквадратическое отклонение
+        @return <tt> sqrt(this->variance()) </tt>
+        */
+        variance_type standard_deviation() const
+        {
+            using std::sqrt;
+            return sqrt(this->variance());
+        }
+
+        /** @brief Коэффициент сглаживания
+        @return Вес нового элемента, заданный при создании
+        */
+        weight_type const & smoothing_factor() const
+        {
+            return this->mean_acc_.smoothing_factor();
+        }
+
+    private:
+        template <class X>
+        ewma_variance_accumulator & update(X const & x)
+        {
+            auto const w = this->mean_acc_.next_weight();
+            auto const keep = weight_type(1) - w;
+
+            this->S_ *= keep;
+            tensor_algebra::add_outer_square_of_difference_impl(this->S_, x, this->mean(),
+                                                                w * keep, 1);
+
+            this->mean_acc_(x);
+
+            return *this;
+        }
+
+        variance_type S_ = variance_type(0.0);
+        Mean_acc mean_acc_;
+    };
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_STATISTICS_EWMA_HPP_INCLUDED
@@ -20,6 +20,8 @@
  @brief Вычисление выборочного среднего
 */
 
+#include <cmath>
+#include <cstdlib>
 #include <type_traits>
 #include <utility>
 
@@ -45,11 +47,345 @@ inline namespace v0
     template <class T, class N>
     using average_type_t = typename average_type<T, N>::type;
 
+    /** @brief Стратегия вычисления среднего, при которой среднее обновляется с учётом каждого
+    нового элемента (метод Уэлфорда)
+
+    Устойчива к ошибкам округления, но требует деления для каждого элемента.
+    */
+    struct welford_policy
+    {};
+
+    /** @brief Стратегия вычисления среднего, при которой накапливается сумма элементов, а деление
+    на их количество выполняется только при запросе среднего
+
+    Для целочисленных элементов сумма накапливается в целочисленном типе расширенной разрядности
+    и поэтому вычисляется точно.
+    */
+    struct deferred_sum_policy
+    {};
+
+    /** @brief Стратегия вычисления, при которой суммы накапливаются с компенсацией ошибок
+    округления (алгоритм Ноймайера)
+
+    Для каждой накапливаемой величины хранится поправка того же типа, поэтому, например, при
+    хранении в @c float точность результатов близка к точности вычислений в @c double.
+    */
+    struct compensated_sum_policy
+    {};
+
+namespace details
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef __int128 signed_wide_sum;
+    __extension__ typedef unsigned __int128 unsigned_wide_sum;
+#else
+    typedef long long signed_wide_sum;
+    typedef unsigned long long unsigned_wide_sum;
+#endif
+}
+// namespace details
+
+    /** @brief Класс-характеристика для определения типа суммы элементов
+    @tparam T тип элементов
+
+    Суммы целых чисел размером меньше @c long @c long хранятся в @c long @c long или
+    @c unsigned @c long @c long, а суммы 64-битных целых --- в 128-битном целом типе, если
+    он поддерживается компилятором.
+    */
+    template <class T>
+    struct sum_type
+    {
+    private:
+        template <class Signed, class Unsigned>
+        using select = std::conditional_t<std::is_signed<T>::value, Signed, Unsigned>;
+
+        using integral_sum
+            = std::conditional_t<(sizeof(T) < sizeof(long long)),
+                                 select<long long, unsigned long long>,
+                                 select<details::signed_wide_sum, details::unsigned_wide_sum>>;
+
+    public:
+        /// @brief Тип суммы элементов
+        using type = std::conditional_t<!std::is_integral<T>::value, T, integral_sum>;
+    };
+
+    /** @brief Тип-синоним для типа суммы элементов
+    @tparam T тип элементов
+    */
+    template <class T>
+    using sum_type_t = typename sum_type<T>::type;
+
+    /** @brief Класс-характеристика для определения стратегии вычисления среднего по умолчанию
+    @tparam T тип элементов
+
+    Для целочисленных типов, для которых @c sum_type_t шире самого типа, используется накопление
+    суммы, для остальных (в том числе для 64-битных целых при отсутствии 128-битного целого типа)
+    --- метод Уэлфорда.
+    */
+    template <class T>
+    struct default_mean_policy
+    {
+        /// @brief Стратегия вычисления среднего
+        using type = std::conditional_t<std::is_integral<T>::value
+                                        && (sizeof(T) < sizeof(sum_type_t<T>)),
+                                        deferred_sum_policy, welford_policy>;
+    };
+
+    /** @brief Тип-синоним для стратегии вычисления среднего по умолчанию
+    @tparam T тип элементов
+    */
+    template <class T>
+    using default_mean_policy_t = typename default_mean_policy<T>::type;
+
+namespace details
+{
+    // Тип скалярных множителей для T: T::value_type для векторов, иначе сам T
+    template <class T, class = void>
+    struct scalar_type
+    {
+        using type = T;
+    };
+
+    template <class T>
+    struct scalar_type<T, decltype(std::declval<typename T::value_type>(), void())>
+    {
+        using type = typename T::value_type;
+    };
+
+    template <class T>
+    using scalar_type_t = typename scalar_type<T>::type;
+
+    template <class Mean, class T, class N>
+    void update_mean(Mean & mean, T const & x, N const & n, long)
+    {
+        mean += (x - mean) / n;
+    }
+
+    template <class Vector1, class Vector2, class N>
+    auto update_mean(Vector1 & mean, Vector2 const & x, N const & n, int)
+    -> decltype(mean.begin(), x.begin(), void())
+    {
+        Vector1::checking_policy::check_equal_dimensions(mean, x);
+
+        auto x_i = x.begin();
+
+        for(auto & m_i : mean)
+        {
+            m_i += (*x_i - m_i) / n;
+            ++ x_i;
+        }
+    }
+
+    template <class Mean, class T, class W, class N>
+    void update_mean(Mean & mean, T const & x, W const & weight, N const & n, long)
+    {
+        mean += (x - mean) * weight / n;
+    }
+
+    template <class Vector1, class Vector2, class W, class N>
+    auto update_mean(Vector1 & mean, Vector2 const & x, W const & weight, N const & n, int)
+    -> decltype(mean.begin(), x.begin(), void())
+    {
+        Vector1::checking_policy::check_equal_dimensions(mean, x);
+
+        auto x_i = x.begin();
+
+        for(auto & m_i : mean)
+        {
+            m_i += (*x_i - m_i) * weight / n;
+            ++ x_i;
+        }
+    }
+
+    template <class Sum, class T>
+    void add_to_sum(Sum & sum, T const & x, long)
+    {
+        sum += x;
+    }
+
+    template <class Vector1, class Vector2>
+    auto add_to_sum(Vector1 & sum, Vector2 const & x, int)
+    -> decltype(sum.begin(), x.begin(), void())
+    {
+        Vector1::checking_policy::check_equal_dimensions(sum, x);
+
+        auto x_i = x.begin();
+
+        for(auto & s_i : sum)
+        {
+            s_i += *x_i;
+            ++ x_i;
+        }
+    }
+
+    template <class Sum, class T>
+    void subtract_from_sum(Sum & sum, T const & x, long)
+    {
+        sum -= x;
+    }
+
+    template <class Vector1, class Vector2>
+    auto subtract_from_sum(Vector1 & sum, Vector2 const & x, int)
+    -> decltype(sum.begin(), x.begin(), void())
+    {
+        Vector1::checking_policy::check_equal_dimensions(sum, x);
+
+        auto x_i = x.begin();
+
+        for(auto & s_i : sum)
+        {
+            s_i -= *x_i;
+            ++ x_i;
+        }
+    }
+
+    // Шаг суммирования Ноймайера: sum + compensation увеличивается на term
+    template <class T>
+    void neumaier_add(T & sum, T & compensation, T const & term)
+    {
+        using std::abs;
+
+        auto const t = sum + term;
+
+        if(abs(sum) >= abs(term))
+        {
+            compensation += (sum - t) + term;
+        }
+        else
+        {
+            compensation += (term - t) + sum;
+        }
+
+        sum = t;
+    }
+
+    template <class Sum, class T, class Sign>
+    void add_compensated(Sum & sum, Sum & compensation, T const & x, Sign const & sign, long)
+    {
+        details::neumaier_add(sum, compensation, static_cast<Sum>(sign * x));
+    }
+
+    template <class Vector1, class Vector2, class Sign>
+    auto add_compensated(Vector1 & sum, Vector1 & compensation, Vector2 const & x,
+                         Sign const & sign, int)
+    -> decltype(sum.begin(), x.begin(), void())
+    {
+        using T = std::decay_t<decltype(*sum.begin())>;
+
+        Vector1::checking_policy::check_equal_dimensions(sum, x);
+
+        auto x_i = x.begin();
+        auto c_i = compensation.begin();
+
+        for(auto & s_i : sum)
+        {
+            details::neumaier_add(s_i, *c_i, static_cast<T>(sign * *x_i));
+            ++ x_i;
+            ++ c_i;
+        }
+    }
+
+    template <class T, class U>
+    void accumulate_term(T & sum, T &, U const & term, welford_policy)
+    {
+        sum += term;
+    }
+
+    template <class T, class U>
+    void accumulate_term(T & sum, T & compensation, U const & term, compensated_sum_policy)
+    {
+        details::neumaier_add(sum, compensation, static_cast<T>(term));
+    }
+
+    template <class T>
+    T compensated_value(T const & sum, T const & compensation, long)
+    {
+        return sum + compensation;
+    }
+
+    template <class Vector>
+    auto compensated_value(Vector const & sum, Vector const & compensation, int)
+    -> decltype(sum.begin(), Vector(sum))
+    {
+        Vector result(sum);
+        result += compensation;
+        return result;
+    }
+
+    template <class Mean, class Sum, class N>
+    Mean mean_of_sum(Sum const & sum, N const & n, long)
+    {
+        return static_cast<Mean>(sum) / n;
+    }
+
+    template <class Mean, class Sum, class N>
+    auto mean_of_sum(Sum const & sum, N const & n, int)
+    -> decltype(sum.begin(), Mean(sum))
+    {
+        Mean result(sum);
+        result /= n;
+        return result;
+    }
+
+    template <class T, class X, class = void>
+    struct is_other_vector
+     : std::false_type
+    {};
+
+    template <class T, class X>
+    struct is_other_vector<T, X, decltype(std::declval<T const &>().begin(),
+                                          std::declval<X const &>().begin(), void())>
+     : std::integral_constant<bool, !std::is_same<T, X>::value>
+    {};
+}
+// namespace details
+
+    /** @brief Обновление среднего значения с учётом нового элемента
+    @param mean текущее среднее значение
+    @param x новый элемент
+    @param n количество элементов с учётом нового
+    @pre Если @c mean и @c x --- векторы, то <tt> mean.dim() == x.dim() </tt>
+    @post <tt> mean += (x - mean) / n </tt>
+
+    Если @c mean и @c x являются векторами (то есть имеют функцию-член @c begin), то вычисления
+    проводятся поэлементно без создания временных векторов, при этом @c x может быть вектором
+    другого типа, например, представлением данных, хранящихся во внешнем буфере.
+    */
+    template <class Mean, class T, class N>
+    void update_mean(Mean & mean, T const & x, N const & n)
+    {
+        details::update_mean(mean, x, n, 0);
+    }
+
+    /** @brief Обновление среднего значения с учётом группы элементов
+    @param mean текущее среднее значение
+    @param x среднее значение элементов группы
+    @param weight количество элементов группы
+    @param n количество элементов с учётом группы
+    @pre Если @c mean и @c x --- векторы, то <tt> mean.dim() == x.dim() </tt>
+    @post <tt> mean += (x - mean) * weight / n </tt>
+
+    Для векторов вычисления проводятся поэлементно без создания временных векторов.
+    */
+    template <class Mean, class T, class W, class N>
+    void update_mean(Mean & mean, T const & x, W const & weight, N const & n)
+    {
+        details::update_mean(mean, x, weight, n, 0);
+    }
+
     /** @brief Накопитель для вычисления выборочного среднего
     @tparam T тип элементов
     @tparam IntType тип для представления количества элементов
+    @tparam Policy стратегия вычисления среднего: @c welford_policy или @c deferred_sum_policy
+    @tparam Accumulation тип, в котором хранится и обновляется среднее
+
+    Основной шаблон реализует метод Уэлфорда. Тип @c Accumulation может быть шире типа
+    элементов: например, элементы типа @c float или @c math_vector<float> могут накапливаться в
+    @c double или @c math_vector<double> соответственно, при этом каждый элемент преобразуется к
+    более широкому типу непосредственно при обновлении, без создания временных объектов.
     */
-    template <class T, class IntType = int>
+    template <class T, class IntType = int, class Policy = default_mean_policy_t<T>,
+              class Accumulation = average_type_t<T, IntType>>
     class mean_accumulator
     {
     public:
@@ -57,7 +393,7 @@ inline namespace v0
         using counter_type = IntType;
 
         /// @brief Тип среднего
-        using mean_type = average_type_t<T, IntType>;
+        using mean_type = Accumulation;
 
         /** @brief Конструктор
         @post <tt> this->count() == 0 </tt>
@@ -83,11 +419,140 @@ inline namespace v0
         {
             ++ this->n_;
 
-            this->mean_ += (x - this->mean_) / this->n_;
+            ::grabin::update_mean(this->mean_, x, this->n_);
 
             return *this;
         }
 
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новый элемент, например, представление данных, хранящихся во внешнем буфере
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+
+        Элемент учитывается без копирования в объект типа @c T.
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, mean_accumulator &>
+        operator()(Vector const & x)
+        {
+            ++ this->n_;
+
+            ::grabin::update_mean(this->mean_, x, this->n_);
+
+            return *this;
+        }
+
+        /** @brief Исключение ранее учтённого элемента
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы элемент @c x не передавался
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & remove(T const & x)
+        {
+            return this->downdate(x);
+        }
+
+        /** @brief Исключение ранее учтённого элемента, заданного вектором другого типа
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, mean_accumulator &>
+        remove(Vector const & x)
+        {
+            return this->downdate(x);
+        }
+
+        /** @brief Обновление статистик с учётом группы элементов с известным средним
+        @param count количество элементов группы
+        @param mean среднее значение элементов группы
+        @pre <tt> count >= 0 </tt>
+        @post <tt> this->count() </tt> увеличивается на @c count, а <tt> this->mean() </tt>
+        становится равным среднему значению объединения обработанных элементов и группы
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & merge(counter_type const & count, mean_type const & mean)
+        {
+            if(count == 0)
+            {
+                return *this;
+            }
+
+            if(this->n_ == 0)
+            {
+                this->n_ = count;
+                this->mean_ = mean;
+
+                return *this;
+            }
+
+            this->n_ += count;
+
+            ::grabin::update_mean(this->mean_, mean, count, this->n_);
+
+            return *this;
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы элементы, обработанные @c other, были
+        переданы <tt> *this </tt>
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & merge(mean_accumulator const & other)
+        {
+            return this->merge(other.count(), other.mean());
+        }
+
+        /** @brief Исключение группы ранее учтённых элементов с известным средним
+        @param count количество элементов группы
+        @param mean среднее значение элементов группы
+        @pre <tt> 0 <= count && count <= this->count() </tt>
+        @pre Все элементы группы ранее были учтены <tt> *this </tt>
+        @post <tt> this->count() </tt> уменьшается на @c count, а <tt> this->mean() </tt>
+        становится равным среднему значению оставшихся элементов
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & subtract(counter_type const & count, mean_type const & mean)
+        {
+            if(count == 0)
+            {
+                return *this;
+            }
+
+            this->n_ -= count;
+
+            if(this->n_ == 0)
+            {
+                this->mean_ *= 0;
+            }
+            else
+            {
+                using Scalar = details::scalar_type_t<mean_type>;
+                ::grabin::update_mean(this->mean_, mean, -Scalar(count), this->n_);
+            }
+
+            return *this;
+        }
+
+        /** @brief Исключение элементов, учтённых другим накопителем
+        @param other накопитель, элементы которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы элементы, обработанные @c other, не
+        передавались <tt> *this </tt>, то есть <tt> x.merge(y).subtract(y) </tt> равно @c x
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & subtract(mean_accumulator const & other)
+        {
+            return this->subtract(other.count(), other.mean());
+        }
+
         /** @brief Количество элементов
         @return Количество обработанных к настоящему моменту элементов
         */
@@ -105,9 +570,343 @@ inline namespace v0
         }
 
     private:
+        template <class X>
+        mean_accumulator & downdate(X const & x)
+        {
+            -- this->n_;
+
+            if(this->n_ == 0)
+            {
+                this->mean_ *= 0;
+            }
+            else
+            {
+                ::grabin::update_mean(this->mean_, x, -1, this->n_);
+            }
+
+            return *this;
+        }
+
         counter_type n_ = counter_type(0);
         mean_type mean_ = mean_type(0);
     };
+
+    /** @brief Накопитель для вычисления выборочного среднего, который хранит сумму элементов
+    @tparam T тип элементов
+    @tparam IntType тип для представления количества элементов
+    @tparam Accumulation тип среднего, а для нецелочисленных элементов --- и тип суммы
+
+    Обновление сводится к сложению, а деление на количество элементов выполняется только при
+    вызове @c mean. Для целочисленных элементов сумма, а значит и результаты объединения и
+    исключения элементов, вычисляются точно.
+    */
+    template <class T, class IntType, class Accumulation>
+    class mean_accumulator<T, IntType, deferred_sum_policy, Accumulation>
+    {
+    public:
+        /// @brief Тип количества элементов
+        using counter_type = IntType;
+
+        /// @brief Тип среднего
+        using mean_type = Accumulation;
+
+        /// @brief Тип суммы элементов
+        using sum_type = std::conditional_t<std::is_integral<T>::value, sum_type_t<T>, mean_type>;
+
+        /** @brief Конструктор
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->sum() == T(0) </tt>
+        */
+        mean_accumulator() = default;
+
+        /** @brief Конструктор с явным заданием "нулевого" элемента
+        @param zero "нулевой" элемент
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->sum() == zero </tt>
+        */
+        mean_accumulator(T zero)
+         : n_(0)
+         , sum_(std::move(zero))
+        {}
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param x новый элемент
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & operator()(T const & x)
+        {
+            ++ this->n_;
+
+            details::add_to_sum(this->sum_, x, 0);
+
+            return *this;
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новый элемент, например, представление данных, хранящихся во внешнем буфере
+        @pre <tt> x.dim() == this->sum().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, mean_accumulator &>
+        operator()(Vector const & x)
+        {
+            ++ this->n_;
+
+            details::add_to_sum(this->sum_, x, 0);
+
+            return *this;
+        }
+
+        /** @brief Исключение ранее учтённого элемента
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & remove(T const & x)
+        {
+            -- this->n_;
+
+            details::subtract_from_sum(this->sum_, x, 0);
+
+            return *this;
+        }
+
+        /** @brief Исключение ранее учтённого элемента, заданного вектором другого типа
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @pre <tt> x.dim() == this->sum().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, mean_accumulator &>
+        remove(Vector const & x)
+        {
+            -- this->n_;
+
+            details::subtract_from_sum(this->sum_, x, 0);
+
+            return *this;
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & merge(mean_accumulator const & other)
+        {
+            this->n_ += other.n_;
+            details::add_to_sum(this->sum_, other.sum_, 0);
+
+            return *this;
+        }
+
+        /** @brief Исключение элементов, учтённых другим накопителем
+        @param other накопитель, элементы которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & subtract(mean_accumulator const & other)
+        {
+            this->n_ -= other.n_;
+            details::subtract_from_sum(this->sum_, other.sum_, 0);
+
+            return *this;
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->n_;
+        }
+
+        /** @brief Сумма элементов
+        @return Сумма обработанных к настоящему моменту элементов
+        */
+        sum_type const & sum() const
+        {
+            return this->sum_;
+        }
+
+        /** @brief Среднее значение
+        @return <tt> this->sum() / this->count() </tt>, если <tt> this->count() > 0 </tt>, иначе
+        --- <tt> this->sum() </tt>, приведённая к типу среднего
+        */
+        mean_type mean() const
+        {
+            if(this->n_ == 0)
+            {
+                return static_cast<mean_type>(this->sum_);
+            }
+
+            return details::mean_of_sum<mean_type>(this->sum_, this->n_, 0);
+        }
+
+    private:
+        counter_type n_ = counter_type(0);
+        sum_type sum_ = sum_type(0);
+    };
+
+    /** @brief Накопитель для вычисления выборочного среднего, который хранит сумму элементов с
+    поправкой на ошибки округления
+    @tparam T тип элементов
+    @tparam IntType тип для представления количества элементов
+    @tparam Accumulation тип среднего, а для нецелочисленных элементов --- и тип суммы и поправки
+
+    Как и при стратегии @c deferred_sum_policy, деление выполняется только при вызове @c mean, но
+    сумма накапливается по алгоритму Ноймайера, поэтому её погрешность не растёт с количеством
+    элементов.
+    */
+    template <class T, class IntType, class Accumulation>
+    class mean_accumulator<T, IntType, compensated_sum_policy, Accumulation>
+    {
+    public:
+        /// @brief Тип количества элементов
+        using counter_type = IntType;
+
+        /// @brief Тип среднего
+        using mean_type = Accumulation;
+
+        /// @brief Тип суммы элементов
+        using sum_type = std::conditional_t<std::is_integral<T>::value, sum_type_t<T>, mean_type>;
+
+        /** @brief Конструктор
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->sum() == T(0) </tt>
+        */
+        mean_accumulator() = default;
+
+        /** @brief Конструктор с явным заданием "нулевого" элемента
+        @param zero "нулевой" элемент
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->sum() == zero </tt>
+        */
+        mean_accumulator(T zero)
+         : n_(0)
+         , sum_(zero)
+         , compensation_(std::move(zero))
+        {}
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param x новый элемент
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & operator()(T const & x)
+        {
+            return this->add(x, 1);
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новый элемент, например, представление данных, хранящихся во внешнем буфере
+        @pre <tt> x.dim() == this->sum().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, mean_accumulator &>
+        operator()(Vector const & x)
+        {
+            return this->add(x, 1);
+        }
+
+        /** @brief Исключение ранее учтённого элемента
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & remove(T const & x)
+        {
+            return this->add(x, -1);
+        }
+
+        /** @brief Исключение ранее учтённого элемента, заданного вектором другого типа
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @pre <tt> x.dim() == this->sum().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, mean_accumulator &>
+        remove(Vector const & x)
+        {
+            return this->add(x, -1);
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & merge(mean_accumulator const & other)
+        {
+            return this->combine(other, 1);
+        }
+
+        /** @brief Исключение элементов, учтённых другим накопителем
+        @param other накопитель, элементы которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @return <tt> *this </tt>
+        */
+        mean_accumulator & subtract(mean_accumulator const & other)
+        {
+            return this->combine(other, -1);
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->n_;
+        }
+
+        /** @brief Сумма элементов
+        @return Сумма обработанных к настоящему моменту элементов с учётом поправки
+        */
+        sum_type sum() const
+        {
+            return details::compensated_value(this->sum_, this->compensation_, 0);
+        }
+
+        /** @brief Среднее значение
+        @return <tt> this->sum() / this->count() </tt>, если <tt> this->count() > 0 </tt>, иначе
+        --- <tt> this->sum() </tt>, приведённая к типу среднего
+        */
+        mean_type mean() const
+        {
+            if(this->n_ == 0)
+            {
+                return static_cast<mean_type>(this->sum_);
+            }
+
+            return details::mean_of_sum<mean_type>(this->sum(), this->n_, 0);
+        }
+
+    private:
+        template <class X>
+        mean_accumulator & add(X const & x, int sign)
+        {
+            this->n_ += sign;
+
+            details::add_compensated(this->sum_, this->compensation_, x, sign, 0);
+
+            return *this;
+        }
+
+        mean_accumulator & combine(mean_accumulator const & other, int sign)
+        {
+            this->n_ += sign * other.n_;
+
+            details::add_compensated(this->sum_, this->compensation_, other.sum_, sign, 0);
+            details::add_compensated(this->sum_, this->compensation_, other.compensation_, sign, 0);
+
+            return *this;
+        }
+
+        counter_type n_ = counter_type(0);
+        sum_type sum_ = sum_type(0);
+        sum_type compensation_ = sum_type(0);
+    };
 }
 // namespace v0
 }
@@ -0,0 +1,159 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_STATISTICS_PAIRWISE_HPP_INCLUDED
+#define Z_GRABIN_STATISTICS_PAIRWISE_HPP_INCLUDED
+
+/** @file grabin/statistics/pairwise.hpp
+ @brief Попарное объединение накопителей
+*/
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v0
+{
+    /** @brief Накопитель, объединяющий статистики блоков элементов по схеме попарного суммирования
+    @tparam Accumulator тип накопителя, поддерживающего объединение с помощью функции-члена
+    @c merge, например, @c mean_accumulator, @c variance_accumulator или
+    @c linear_regression_accumulator
+
+    Элементы передаются накопителю текущего блока. Заполненный блок помещается в стек, в котором
+    накопители с одинаковым количеством блоков объединяются, как при увеличении двоичного
+    счётчика. Поэтому каждый элемент участвует не более чем в <tt> log2(n / block_size) </tt>
+    объединениях накопителей примерно равного размера, и ошибка округления растёт логарифмически, а
+    не линейно относительно количества элементов. Стек содержит не более
+    <tt> log2(n / block_size) + 1 </tt> накопителей, память для которых используется повторно.
+    */
+    template <class Accumulator>
+    class pairwise_accumulator
+    {
+    public:
+        /// @brief Тип накопителя
+        using accumulator_type = Accumulator;
+
+        /// @brief Тип количества элементов
+        using size_type = std::size_t;
+
+        /** @brief Конструктор
+        @param init накопитель, которому не передавались элементы
+        @param block_size количество элементов в блоке, обрабатываемом одним накопителем
+        @throw logic_error, если <tt> block_size == 0 </tt>
+        @post <tt> this->block_size() == block_size </tt>
+        */
+        explicit pairwise_accumulator(Accumulator init = Accumulator(), size_type block_size = 64)
+         : init_(init)
+         , block_(std::move(init))
+         , block_size_(block_size)
+        {
+            if(block_size == 0)
+            {
+                throw std::logic_error("Block size must be positive");
+            }
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param args аргументы, задающие новый элемент
+        @return <tt> *this </tt>
+        */
+        template <class... Args>
+        pairwise_accumulator & operator()(Args const & ... args)
+        {
+            this->block_(args...);
+
+            if(++ this->block_count_ == this->block_size_)
+            {
+                this->push_block();
+            }
+
+            return *this;
+        }
+
+        /** @brief Результат
+        @return Накопитель, статистики которого получены объединением всех блоков, начиная с
+        последних (наименьших)
+        */
+        Accumulator result() const
+        {
+            auto result = this->block_;
+
+            for(auto i = this->depth_; i > 0; -- i)
+            {
+                auto partial = this->stack_[i - 1].first;
+                partial.merge(result);
+                result = std::move(partial);
+            }
+
+            return result;
+        }
+
+        /** @brief Размер блока
+        @return Количество элементов в блоке, заданное при создании
+        */
+        size_type block_size() const
+        {
+            return this->block_size_;
+        }
+
+    private:
+        void push_block()
+        {
+            if(this->depth_ < this->stack_.size())
+            {
+                this->stack_[this->depth_].first = this->block_;
+                this->stack_[this->depth_].second = 0;
+            }
+            else
+            {
+                this->stack_.emplace_back(this->block_, 0);
+            }
+
+            ++ this->depth_;
+
+            // Объединение накопителей с одинаковым количеством блоков
+            while(this->depth_ >= 2
+                  && this->stack_[this->depth_ - 2].second == this->stack_[this->depth_ - 1].second)
+            {
+                auto & lower = this->stack_[this->depth_ - 2];
+
+                lower.first.merge(this->stack_[this->depth_ - 1].first);
+                ++ lower.second;
+
+                -- this->depth_;
+            }
+
+            this->block_ = this->init_;
+            this->block_count_ = 0;
+        }
+
+        Accumulator init_;
+        Accumulator block_;
+        size_type block_size_;
+        size_type block_count_ = 0;
+
+        // Пары "накопитель, двоичный логарифм количества блоков"
+        std::vector<std::pair<Accumulator, size_type>> stack_;
+        size_type depth_ = 0;
+    };
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_STATISTICS_PAIRWISE_HPP_INCLUDED
@@ -21,6 +21,10 @@
 */
 
 #include <grabin/statistics/variance.hpp>
+#include <grabin/linear_algebra/cholesky.hpp>
+#include <grabin/linear_algebra/math_vector.hpp>
+
+#include <stdexcept>
 
 namespace grabin
 {
@@ -30,13 +34,26 @@ inline namespace v0
     @tparam Input тип входной переменной
     @tparam Output тип выходной переменной
     @tparam IntType тип для представления объёма выборки
+    @tparam Policy стратегия накопления средних и моментов: @c welford_policy или
+    @c compensated_sum_policy
+    @tparam Accumulation тип, в котором накапливается смешанный момент, а с учётом
+    @c average_type --- и средние, и дисперсия входной переменной
+
+    Например, <tt> linear_regression_accumulator<float, float, int, welford_policy, double> </tt>
+    принимает пары чисел типа @c float, но все накопленные величины хранит и обновляет в
+    @c double. Коэффициенты по-прежнему возвращаются в типах @c Input и @c Output.
     */
-    template <class Input, class Output = Input, class IntType = int>
+    template <class Input, class Output = Input, class IntType = int,
+              class Policy = welford_policy,
+              class Accumulation = decltype(std::declval<Input>() * std::declval<Output>())>
     class linear_regression_accumulator
     {
-        using Input_acc = grabin::variance_accumulator<Input, IntType>;
-        using Output_acc = grabin::mean_accumulator<Output, IntType>;
-        using covariance_type = decltype(std::declval<Input>() * std::declval<Output>());
+        using Input_acc = grabin::variance_accumulator<Input, IntType, default_tensor_algebra,
+                                                       Policy,
+                                                       average_type_t<Accumulation, IntType>>;
+        using Output_acc = grabin::mean_accumulator<Output, IntType, Policy,
+                                                    average_type_t<Accumulation, IntType>>;
+        using covariance_type = Accumulation;
 
     public:
         /// @brief Тип для представления количества элементов выборки
@@ -67,7 +84,110 @@ inline namespace v0
             this->x_stat_(x);
             this->y_stat_(y);
 
-            this->cov_ += (x - this->x_stat_.mean()) * (y - my_old);
+            this->add_to_covariance((x - this->x_stat_.mean()) * (y - my_old));
+
+            return *this;
+        }
+
+        /** @brief Исключение ранее учтённой пары элементов
+        @param x значение входной переменной
+        @param y соответствующее значение выходной переменной
+        @pre <tt> this->count() > 0 </tt>
+        @pre Пара <tt> (x, y) </tt> ранее была передана <tt> operator() </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы пара <tt> (x, y) </tt> не передавалась
+        @return <tt> *this </tt>
+        */
+        linear_regression_accumulator & remove(Input const & x, Output const & y)
+        {
+            if(this->count() == 1)
+            {
+                this->cov_ *= 0;
+                this->cov_lo_ *= 0;
+            }
+            else
+            {
+                auto const n = covariance_type(this->count());
+
+                this->add_to_covariance(-(x - this->x_stat_.mean()) * (y - this->y_stat_.mean())
+                                        * n / (n - 1));
+            }
+
+            this->x_stat_.remove(x);
+            this->y_stat_.remove(y);
+
+            return *this;
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы пары элементов, обработанные @c other, были
+        переданы <tt> *this </tt>
+        @return <tt> *this </tt>
+        */
+        linear_regression_accumulator & merge(linear_regression_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(this->count() == 0)
+            {
+                *this = other;
+                return *this;
+            }
+
+            auto const weight = covariance_type(this->count()) * covariance_type(other.count());
+            auto const n = this->count() + other.count();
+
+            this->add_to_covariance(other.cov_);
+            this->add_to_covariance(other.cov_lo_);
+            this->add_to_covariance((other.x_stat_.mean() - this->x_stat_.mean())
+                                    * (other.y_stat_.mean() - this->y_stat_.mean()) * weight / n);
+
+            this->x_stat_.merge(other.x_stat_);
+            this->y_stat_.merge(other.y_stat_);
+
+            return *this;
+        }
+
+        /** @brief Исключение пар элементов, учтённых другим накопителем
+        @param other накопитель, пары элементов которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы пары элементов, обработанные @c other, не
+        передавались <tt> *this </tt>
+        @return <tt> *this </tt>
+        */
+        linear_regression_accumulator & subtract(linear_regression_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(other.count() == this->count())
+            {
+                this->cov_ *= 0;
+                this->cov_lo_ *= 0;
+            }
+            else
+            {
+                auto const weight = covariance_type(this->count())
+                                    * covariance_type(other.count());
+                auto const n = this->count() - other.count();
+
+                this->add_to_covariance(-other.cov_);
+                this->add_to_covariance(-other.cov_lo_);
+                this->add_to_covariance(-(other.x_stat_.mean() - this->x_stat_.mean())
+                                        * (other.y_stat_.mean() - this->y_stat_.mean())
+                                        * weight / n);
+            }
+
+            this->x_stat_.subtract(other.x_stat_);
+            this->y_stat_.subtract(other.y_stat_);
 
             return *this;
         }
@@ -99,7 +219,7 @@ inline namespace v0
             }
             else if(this->x_stat_.variance() > 0)
             {
-                return (this->cov_ / this->count()) / this->x_stat_.variance();
+                return ((this->cov_ + this->cov_lo_) / this->count()) / this->x_stat_.variance();
             }
             else
             {
@@ -108,9 +228,501 @@ inline namespace v0
         }
 
     private:
+        void add_to_covariance(covariance_type const & term)
+        {
+            details::accumulate_term(this->cov_, this->cov_lo_, term, Policy{});
+        }
+
         Input_acc x_stat_;
         Output_acc y_stat_;
         covariance_type cov_ = covariance_type{0.0};
+        covariance_type cov_lo_ = covariance_type{0.0};
+    };
+
+    /** @brief Накопитель для вычисления коэффициентов множественной линейной регрессии
+    @tparam Input тип вектора входных переменных, например, @c math_vector
+    @tparam Output тип выходной переменной
+    @tparam IntType тип для представления объёма выборки
+
+    За один проход накапливаются средние, упакованная матрица вторых центральных моментов входных
+    переменных и вектор смешанных центральных моментов входных и выходной переменных. Коэффициенты
+    вычисляются по требованию решением нормальных уравнений с помощью разложения Холецкого
+    упакованной матрицы, поэтому их вычисление требует порядка <tt> p^3/3 </tt> операций, где
+    @c p &mdash; количество входных переменных, независимо от объёма выборки.
+    */
+    template <class Input, class Output = typename Input::value_type, class IntType = int>
+    class multiple_linear_regression_accumulator
+    {
+        using Input_acc = grabin::variance_accumulator<Input, IntType>;
+        using Output_acc = grabin::mean_accumulator<Output, IntType, welford_policy>;
+        using Scalar = details::scalar_type_t<typename Input_acc::mean_type>;
+
+    public:
+        /// @brief Тип для представления количества элементов выборки
+        using counter_type = typename Input_acc::counter_type;
+
+        /// @brief Тип постоянного слагаемого
+        using intercept_type = Output;
+
+        /// @brief Тип для хранения коэффициентов
+        using effect_type = Input;
+
+        /** @brief Конструктор
+        @param zero нулевой вектор, размерность которого равна количеству входных переменных
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->intercept() == Output{0} </tt>
+        @post <tt> this->effect() == zero </tt>
+        */
+        explicit multiple_linear_regression_accumulator(Input zero)
+         : x_stat_(zero)
+         , cross_(std::move(zero))
+        {}
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param x новое значение вектора входных переменных
+        @param y соответствующее значение выходной переменной
+        @return <tt> *this </tt>
+        @throw То же, что <tt> Input::checking_policy::check_equal_dimensions </tt>, если
+        размерность @c x не совпадает с количеством входных переменных
+        */
+        multiple_linear_regression_accumulator &
+        operator()(Input const & x, Output const & y)
+        {
+            return this->update(x, y);
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новое значение вектора входных переменных, например, представление данных,
+        хранящихся во внешнем буфере
+        @param y соответствующее значение выходной переменной
+        @return <tt> *this </tt>
+        @throw То же, что <tt> Input::checking_policy::check_equal_dimensions </tt>, если
+        размерность @c x не совпадает с количеством входных переменных
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<Input, Vector>::value,
+                         multiple_linear_regression_accumulator &>
+        operator()(Vector const & x, Output const & y)
+        {
+            return this->update(x, y);
+        }
+
+        /** @brief Исключение ранее учтённого элемента
+        @param x значение вектора входных переменных
+        @param y соответствующее значение выходной переменной
+        @pre <tt> this->count() > 0 </tt>
+        @pre Пара <tt> (x, y) </tt> ранее была передана <tt> operator() </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы пара <tt> (x, y) </tt> не передавалась
+        @return <tt> *this </tt>
+        @throw То же, что <tt> Input::checking_policy::check_equal_dimensions </tt>, если
+        размерность @c x не совпадает с количеством входных переменных
+        */
+        multiple_linear_regression_accumulator & remove(Input const & x, Output const & y)
+        {
+            return this->downdate(x, y);
+        }
+
+        /** @brief Исключение ранее учтённого элемента, заданного вектором другого типа
+        @param x значение вектора входных переменных, например, представление данных,
+        хранящихся во внешнем буфере
+        @param y соответствующее значение выходной переменной
+        @pre <tt> this->count() > 0 </tt>
+        @pre Пара <tt> (x, y) </tt> ранее была передана <tt> operator() </tt>
+        @return <tt> *this </tt>
+        @throw То же, что <tt> Input::checking_policy::check_equal_dimensions </tt>, если
+        размерность @c x не совпадает с количеством входных переменных
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<Input, Vector>::value,
+                         multiple_linear_regression_accumulator &>
+        remove(Vector const & x, Output const & y)
+        {
+            return this->downdate(x, y);
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы пары элементов, обработанные @c other, были
+        переданы <tt> *this </tt>
+        @return <tt> *this </tt>
+        */
+        multiple_linear_regression_accumulator &
+        merge(multiple_linear_regression_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(this->count() == 0)
+            {
+                *this = other;
+                return *this;
+            }
+
+            auto const weight = Scalar(this->count()) * Scalar(other.count());
+            auto const n = this->count() + other.count();
+
+            auto const dy = (other.y_stat_.mean() - this->y_stat_.mean()) * weight / n;
+
+            this->cross_ += other.cross_;
+            this->cross_ += (other.x_stat_.mean() - this->x_stat_.mean()) * dy;
+
+            this->x_stat_.merge(other.x_stat_);
+            this->y_stat_.merge(other.y_stat_);
+
+            return *this;
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->x_stat_.count();
+        }
+
+        /** @brief Исключение элементов, учтённых другим накопителем
+        @param other накопитель, элементы которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы пары элементов, обработанные @c other, не
+        передавались <tt> *this </tt>
+        @return <tt> *this </tt>
+
+        Например, для k-кратной перекрёстной проверки достаточно накопить статистики каждой части
+        выборки и их объединение, после чего статистики для обучения без i-ой части получаются
+        вычитанием её статистик из статистик всей выборки.
+        */
+        multiple_linear_regression_accumulator &
+        subtract(multiple_linear_regression_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(other.count() == this->count())
+            {
+                this->cross_ *= 0.0;
+            }
+            else
+            {
+                auto const weight = Scalar(this->count()) * Scalar(other.count());
+                auto const n = this->count() - other.count();
+
+                auto const dy = (other.y_stat_.mean() - this->y_stat_.mean()) * weight / n;
+
+                this->cross_ -= other.cross_;
+                this->cross_ -= (other.x_stat_.mean() - this->x_stat_.mean()) * dy;
+            }
+
+            this->x_stat_.subtract(other.x_stat_);
+            this->y_stat_.subtract(other.y_stat_);
+
+            return *this;
+        }
+
+        /** @brief Средние значения входных переменных
+        @return Накопленные к настоящему моменту средние значения входных переменных
+        */
+        typename Input_acc::mean_type const & input_mean() const
+        {
+            return this->x_stat_.mean();
+        }
+
+        /** @brief Среднее значение выходной переменной
+        @return Накопленное к настоящему моменту среднее значение выходной переменной
+        */
+        typename Output_acc::mean_type const & output_mean() const
+        {
+            return this->y_stat_.mean();
+        }
+
+        /** @brief Постоянное слагаемое
+        @return Накопленное к настоящему моменту постоянное слагаемое
+        @throw То же, что <tt> this->effect() </tt>
+        */
+        intercept_type intercept() const
+        {
+            return this->y_stat_.mean() - ::grabin::dot(this->effect(), this->x_stat_.mean());
+        }
+
+        /** @brief Коэффициенты при входных переменных
+        @return Накопленные к настоящему моменту значения коэффициентов. Если обработано менее
+        двух элементов, то возвращается нулевой вектор.
+        @throw factorization_error, если матрица ковариаций входных переменных вырождена, например,
+        если входные переменные линейно зависимы или элементов меньше, чем входных переменных
+        */
+        effect_type effect() const
+        {
+            auto result = this->cross_;
+
+            if(this->count() < 2)
+            {
+                result *= 0.0;
+                return result;
+            }
+
+            auto covariance = this->x_stat_.variance();
+            ::grabin::cholesky_factorize(covariance);
+
+            result /= this->count();
+            ::grabin::cholesky_solve(covariance, result);
+
+            return result;
+        }
+
+    private:
+        template <class Vector>
+        multiple_linear_regression_accumulator &
+        update(Vector const & x, Output const & y)
+        {
+            Input::checking_policy::check_equal_dimensions(this->cross_, x);
+
+            auto const my_old = this->y_stat_.mean();
+            this->x_stat_(x);
+            this->y_stat_(y);
+
+            auto const dy = y - my_old;
+            auto const x_first = x.begin();
+            auto const mean_first = this->x_stat_.mean().begin();
+            auto const cross_first = this->cross_.begin();
+
+            for(auto i = 0*this->cross_.dim(); i < this->cross_.dim(); ++ i)
+            {
+                cross_first[i] += (x_first[i] - mean_first[i]) * dy;
+            }
+
+            return *this;
+        }
+
+        template <class Vector>
+        multiple_linear_regression_accumulator &
+        downdate(Vector const & x, Output const & y)
+        {
+            Input::checking_policy::check_equal_dimensions(this->cross_, x);
+
+            if(this->count() == 1)
+            {
+                this->cross_ *= 0.0;
+            }
+            else
+            {
+                auto const n = Scalar(this->count());
+                auto const dy = (y - this->y_stat_.mean()) * n / (n - 1);
+                auto const x_first = x.begin();
+                auto const mean_first = this->x_stat_.mean().begin();
+                auto const cross_first = this->cross_.begin();
+
+                for(auto i = 0*this->cross_.dim(); i < this->cross_.dim(); ++ i)
+                {
+                    cross_first[i] -= (x_first[i] - mean_first[i]) * dy;
+                }
+            }
+
+            this->x_stat_.remove(x);
+            this->y_stat_.remove(y);
+
+            return *this;
+        }
+
+        Input_acc x_stat_;
+        Output_acc y_stat_;
+        Input cross_;
+    };
+
+    /** @brief Накопитель для вычисления коэффициентов линейной регрессии рекурсивным методом
+    наименьших квадратов с экспоненциальным забыванием
+    @tparam Input тип вектора входных переменных, например, @c math_vector
+    @tparam Output тип выходной переменной
+    @tparam IntType тип для представления объёма выборки
+
+    Коэффициенты минимизируют сумму <tt> lambda^(n-k) * (y_k - b - a * x_k)^2 </tt> по всем
+    обработанным элементам, где @c lambda &mdash; коэффициент забывания, поэтому старые элементы
+    влияют на результат тем меньше, чем раньше они были обработаны. Вместе с коэффициентами
+    хранится обратная матрица моментов (с учётом постоянного слагаемого) в упакованном виде,
+    которая пересчитывается по формуле Шермана-Моррисона, так что обработка одного элемента
+    требует порядка <tt> p^2 </tt> операций и не требует выделения памяти, а получение
+    коэффициентов ничего не стоит.
+    */
+    template <class Input, class Output = typename Input::value_type, class IntType = int>
+    class recursive_least_squares_accumulator
+    {
+        using T = typename Input::value_type;
+        using Matrix = symmetric_matrix<T, typename Input::checking_policy>;
+
+        // Векторы размерности p + 1 хранятся в math_vector, так как Input может иметь
+        // фиксированную размерность (например, static_math_vector)
+        using Scratch = math_vector<T, typename Input::checking_policy>;
+
+    public:
+        /// @brief Тип для представления количества элементов выборки
+        using counter_type = IntType;
+
+        /// @brief Тип постоянного слагаемого
+        using intercept_type = Output;
+
+        /// @brief Тип для хранения коэффициентов
+        using effect_type = Input;
+
+        /// @brief Тип обратной матрицы моментов
+        using matrix_type = Matrix;
+
+        /** @brief Конструктор
+        @param zero нулевой вектор, размерность которого равна количеству входных переменных
+        @param forgetting_factor коэффициент забывания
+        @param regularization начальное значение обратной матрицы моментов равно единичной
+        матрице, делённой на @c regularization, что соответствует гребневой регрессии с этим
+        параметром, вес которой уменьшается по мере забывания
+        @throw logic_error, если <tt> forgetting_factor </tt> не принадлежит <tt> (0; 1] </tt>
+        или <tt> regularization <= 0 </tt>
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->intercept() == Output{0} </tt>
+        @post <tt> this->effect() == zero </tt>
+        */
+        explicit recursive_least_squares_accumulator(Input zero, T const & forgetting_factor = T(1),
+                                                     T const & regularization = T(1e-6))
+         : lambda_(forgetting_factor)
+         , P_(zero.dim() + 1)
+         , z_(zero.dim() + 1)
+         , Pz_(zero.dim() + 1)
+         , effect_(std::move(zero))
+        {
+            if(!(forgetting_factor > T(0) && forgetting_factor <= T(1)))
+            {
+                throw std::logic_error("Forgetting factor must be in (0, 1]");
+            }
+
+            if(!(regularization > T(0)))
+            {
+                throw std::logic_error("Regularization must be positive");
+            }
+
+            for(auto i = 0*this->P_.dim(); i < this->P_.dim(); ++ i)
+            {
+                this->P_(i, i) = T(1) / regularization;
+            }
+        }
+
+        /** @brief Обновление коэффициентов с учётом нового элемента
+        @param x новое значение вектора входных переменных
+        @param y соответствующее значение выходной переменной
+        @return <tt> *this </tt>
+        @throw То же, что <tt> Input::checking_policy::check_equal_dimensions </tt>, если
+        размерность @c x не совпадает с количеством входных переменных
+        */
+        recursive_least_squares_accumulator & operator()(Input const & x, Output const & y)
+        {
+            return this->update(x, y);
+        }
+
+        /** @brief Обновление коэффициентов с учётом нового элемента, заданного вектором другого типа
+        @param x новое значение вектора входных переменных, например, представление данных,
+        хранящихся во внешнем буфере
+        @param y соответствующее значение выходной переменной
+        @return <tt> *this </tt>
+        @throw То же, что <tt> Input::checking_policy::check_equal_dimensions </tt>, если
+        размерность @c x не совпадает с количеством входных переменных
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<Input, Vector>::value,
+                         recursive_least_squares_accumulator &>
+        operator()(Vector const & x, Output const & y)
+        {
+            return this->update(x, y);
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->count_;
+        }
+
+        /** @brief Коэффициент забывания
+        @return Коэффициент забывания, заданный в конструкторе
+        */
+        T const & forgetting_factor() const
+        {
+            return this->lambda_;
+        }
+
+        /** @brief Постоянное слагаемое
+        @return Текущее значение постоянного слагаемого
+        */
+        intercept_type const & intercept() const
+        {
+            return this->intercept_;
+        }
+
+        /** @brief Коэффициенты при входных переменных
+        @return Текущие значения коэффициентов
+        */
+        effect_type const & effect() const
+        {
+            return this->effect_;
+        }
+
+        /** @brief Обратная матрица моментов
+        @return Обратная матрица для взвешенной суммы <tt> z * z^T </tt>, где
+        <tt> z = (1, x) </tt>; её элемент <tt> (0, 0) </tt> относится к постоянному слагаемому
+        */
+        matrix_type const & inverse_moments() const
+        {
+            return this->P_;
+        }
+
+    private:
+        template <class Vector>
+        recursive_least_squares_accumulator & update(Vector const & x, Output const & y)
+        {
+            Input::checking_policy::check_equal_dimensions(this->effect_, x);
+
+            auto const p = this->effect_.dim();
+
+            this->z_[0] = T(1);
+
+            for(auto i = 0*p; i < p; ++ i)
+            {
+                this->z_[i + 1] = x.element(i);
+            }
+
+            ::grabin::symv(T(1), this->P_, this->z_, T(0), this->Pz_);
+
+            auto const denominator = this->lambda_ + ::grabin::dot(this->z_, this->Pz_);
+            auto const error = y - (this->intercept_ + ::grabin::dot(this->effect_, x));
+            auto const gain = error / denominator;
+
+            this->intercept_ += gain * this->Pz_[0];
+
+            for(auto i = 0*p; i < p; ++ i)
+            {
+                this->effect_[i] += gain * this->Pz_[i + 1];
+            }
+
+            this->P_.rank_one_update(-T(1) / denominator, this->Pz_);
+
+            if(this->lambda_ != T(1))
+            {
+                this->P_ /= this->lambda_;
+            }
+
+            ++ this->count_;
+
+            return *this;
+        }
+
+        T lambda_;
+        Matrix P_;
+        Scratch z_;
+        Scratch Pz_;
+        Input effect_;
+        Output intercept_ = Output{0};
+        counter_type count_ = counter_type{0};
     };
 }
 // namespace v0
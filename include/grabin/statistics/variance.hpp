@@ -24,21 +24,161 @@
 #include <grabin/linear_algebra/outer_product.hpp>
 
 #include <cmath>
+#include <iterator>
 
 namespace grabin
 {
 inline namespace v0
 {
+    /** @brief Стратегия вычисления дисперсии целых чисел, при которой накапливаются точные
+    значения суммы элементов и суммы их квадратов
+
+    Суммы хранятся в целочисленном типе @c wide_integer, поэтому объединение накопителей и
+    исключение элементов выполняются точно, а результат не зависит от порядка обработки элементов.
+    Преобразование в тип с плавающей точкой выполняется только при запросе среднего или дисперсии.
+    */
+    struct exact_power_sums_policy
+    {
+#if defined(__SIZEOF_INT128__)
+        /// @brief Тип для хранения сумм
+        __extension__ typedef __int128 wide_integer;
+#else
+        /// @brief Тип для хранения сумм
+        typedef long long wide_integer;
+#endif
+
+        /** @brief Проверка, что суммы квадратов элементов типа @c T помещаются в @c wide_integer
+        @tparam T тип элементов
+        */
+        template <class T>
+        static constexpr bool supports()
+        {
+            return std::is_integral<T>::value && 2 * sizeof(T) < sizeof(wide_integer);
+        }
+    };
+
+    /** @brief Класс-характеристика для определения стратегии вычисления дисперсии по умолчанию
+    @tparam T тип элементов
+
+    Для целочисленных типов, квадраты которых помещаются в
+    <tt> exact_power_sums_policy::wide_integer </tt> с запасом (при наличии 128-битного целого
+    типа это типы размером не более 32 бит), используются точные суммы степеней, для остальных
+    --- метод Уэлфорда.
+    */
+    template <class T>
+    struct default_variance_policy
+    {
+        /// @brief Стратегия вычисления дисперсии
+        using type = std::conditional_t<exact_power_sums_policy::supports<T>(),
+                                        exact_power_sums_policy, welford_policy>;
+    };
+
+    /** @brief Тип-синоним для стратегии вычисления дисперсии по умолчанию
+    @tparam T тип элементов
+    */
+    template <class T>
+    using default_variance_policy_t = typename default_variance_policy<T>::type;
+
+namespace details
+{
+    // S += d * d * s_weight и mean += d * m_weight с компенсацией ошибок округления, где
+    // d = deviation(0)
+    template <class T, class Mean, class Deviation, class W>
+    void add_compensated_moments(T & S, T & S_lo, Mean & mean, Mean & mean_lo,
+                                 Deviation deviation, W const & s_weight, W const & m_weight,
+                                 long)
+    {
+        auto const d = deviation(0);
+
+        details::neumaier_add(S, S_lo, static_cast<T>(d * d * s_weight));
+        details::neumaier_add(mean, mean_lo, static_cast<Mean>(d * m_weight));
+    }
+
+    // S += outer_square(d) * s_weight и mean += d * m_weight с компенсацией ошибок округления,
+    // где d[i] = deviation(i)
+    template <class Matrix, class Vector, class Deviation, class W>
+    auto add_compensated_moments(Matrix & S, Matrix & S_lo, Vector & mean, Vector & mean_lo,
+                                 Deviation deviation, W const & s_weight, W const & m_weight,
+                                 int)
+    -> decltype(S.begin(), mean.begin(), void())
+    {
+        using T = typename Matrix::value_type;
+        using M = typename Vector::value_type;
+
+        auto const n = mean.dim();
+
+        // Упакованное хранение: строки нижнего треугольника расположены последовательно
+        auto s = S.begin();
+        auto c = S_lo.begin();
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            auto const d_i = deviation(i);
+
+            for(auto j = 0*i; j <= i; ++ j, ++ s, ++ c)
+            {
+                details::neumaier_add(*s, *c, static_cast<T>(d_i * deviation(j) * s_weight));
+            }
+        }
+
+        auto const m_first = mean.begin();
+        auto const lo_first = mean_lo.begin();
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            auto const d_i = deviation(i);
+            details::neumaier_add(m_first[i], lo_first[i], static_cast<M>(d_i * m_weight));
+        }
+    }
+
+    template <class T, class Index>
+    T const & element_at(T const & x, Index, long)
+    {
+        return x;
+    }
+
+    template <class Vector, class Index>
+    auto element_at(Vector const & x, Index i, int)
+    -> decltype(x.begin()[i])
+    {
+        return x.begin()[i];
+    }
+
+    template <class T, class X>
+    void check_equal_dimensions(T const &, X const &, long)
+    {}
+
+    template <class Vector, class X>
+    auto check_equal_dimensions(Vector const & x, X const & y, int)
+    -> decltype(x.begin(), y.begin(), void())
+    {
+        Vector::checking_policy::check_equal_dimensions(x, y);
+    }
+}
+// namespace details
+
     /** @brief Накопитель для вычисления дисперсии
     @tparam T тип элементов
     @tparam N тип для представления количества элементов
     @tparam Tensor_algebra используемая тензорная алгебра
+    @tparam Policy стратегия вычисления дисперсии: @c welford_policy,
+    @c compensated_sum_policy или @c exact_power_sums_policy
+    @tparam Accumulation тип, в котором хранится и обновляется среднее
+
+    Основной шаблон реализует метод Уэлфорда. Тип суммы квадратов отклонений определяется
+    тензорной алгеброй, применённой к @c Accumulation. Например, при
+    <tt> T = math_vector<float> </tt>, <tt> Accumulation = math_vector<double> </tt> и тензорной
+    алгебре <tt> tensor_storage<float>::algebra </tt> среднее хранится в @c double, а упакованная
+    матрица --- в @c float, при этом все обновления матрицы вычисляются в @c double.
     */
     template <class T, class IntType = int,
-              template <class> class Tensor_algebra = default_tensor_algebra>
+              template <class> class Tensor_algebra = default_tensor_algebra,
+              class Policy = default_variance_policy_t<T>,
+              class Accumulation = average_type_t<T, IntType>>
     class variance_accumulator
     {
-        using Mean_acc = mean_accumulator<T, IntType>;
+        using Mean_acc = mean_accumulator<T, IntType, welford_policy, Accumulation>;
+        using Scalar = details::scalar_type_t<typename Mean_acc::mean_type>;
 
     public:
         /// @brief Тип количества элементов
@@ -77,13 +217,162 @@ inline namespace v0
         */
         variance_accumulator & operator()(T const & x)
         {
-            this->S_ += this->square_impl(x - this->mean()) * this->count() / (this->count() + 1);
+            tensor_algebra::add_outer_square_of_difference_impl(this->S_, x, this->mean(),
+                                                                this->count(), this->count() + 1);
+
+            this->mean_acc_(x);
+
+            return *this;
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новый элемент, например, представление данных, хранящихся во внешнем буфере
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+
+        Элемент учитывается без копирования в объект типа @c T.
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, variance_accumulator &>
+        operator()(Vector const & x)
+        {
+            tensor_algebra::add_outer_square_of_difference_impl(this->S_, x, this->mean(),
+                                                                this->count(), this->count() + 1);
 
             this->mean_acc_(x);
 
             return *this;
         }
 
+        /** @brief Исключение ранее учтённого элемента
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы элемент @c x не передавался
+        @return <tt> *this </tt>
+
+        Если до исключения было учтено @c n элементов со средним @c m, то из накопленной суммы
+        квадратов отклонений вычитается <tt> outer_square(x - m) * n / (n - 1) </tt>.
+        */
+        variance_accumulator & remove(T const & x)
+        {
+            return this->downdate(x);
+        }
+
+        /** @brief Исключение ранее учтённого элемента, заданного вектором другого типа
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, variance_accumulator &>
+        remove(Vector const & x)
+        {
+            return this->downdate(x);
+        }
+
+        /** @brief Обновление статистик с учётом блока элементов
+        @param first, last интервал, задающий блок элементов
+        @return <tt> *this </tt>
+        @post Результат совпадает с результатом последовательного применения @c operator() ко
+        всем элементам <tt> [first; last) </tt> с точностью до ошибок округления
+
+        Блок центрируется по собственному среднему, его вклад в накопленные статистики
+        вычисляется одним симметричным обновлением ранга k, а затем объединяется с накопленным
+        состоянием.
+        */
+        template <class ForwardIterator>
+        variance_accumulator & update_block(ForwardIterator first, ForwardIterator last)
+        {
+            if(first == last)
+            {
+                return *this;
+            }
+
+            mean_type block_mean = *first;
+            auto block_count = counter_type(1);
+
+            for(auto pos = std::next(first); pos != last; ++ pos)
+            {
+                ++ block_count;
+                ::grabin::update_mean(block_mean, *pos, block_count);
+            }
+
+            tensor_algebra::add_outer_squares_of_differences_impl(this->S_, first, last, block_mean);
+
+            this->merge_means(block_count, block_mean);
+
+            return *this;
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы элементы, обработанные @c other, были
+        переданы <tt> *this </tt>
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & merge(variance_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(this->count() == 0)
+            {
+                *this = other;
+                return *this;
+            }
+
+            this->S_ += other.S_;
+
+            this->merge_means(other.count(), other.mean());
+
+            return *this;
+        }
+
+        /** @brief Исключение элементов, учтённых другим накопителем
+        @param other накопитель, элементы которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @post Состояние <tt> *this </tt> совпадает (с точностью до ошибок округления) с
+        состоянием, которое было бы получено, если бы элементы, обработанные @c other, не
+        передавались <tt> *this </tt>
+        @return <tt> *this </tt>
+
+        Операция обратна @c merge: если <tt> n = this->count() </tt>, <tt> k = other.count() </tt>,
+        то из суммы квадратов отклонений вычитаются сумма квадратов отклонений @c other и
+        <tt> outer_square(other.mean() - this->mean()) * n * k / (n - k) </tt>. Это позволяет,
+        например, получить статистики для перекрёстной проверки как разность статистик всей выборки
+        и статистик одной из её частей.
+        */
+        variance_accumulator & subtract(variance_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(other.count() == this->count())
+            {
+                this->S_ *= 0;
+            }
+            else
+            {
+                auto const n = Scalar(this->count());
+                auto const k = Scalar(other.count());
+
+                this->S_ -= other.S_;
+                tensor_algebra::add_outer_square_of_difference_impl(this->S_, other.mean(),
+                                                                    this->mean(), -n * k, n - k);
+            }
+
+            this->mean_acc_.subtract(other.mean_acc_);
+
+            return *this;
+        }
+
         /** @brief Количество элементов
         @return Количество обработанных к настоящему моменту элементов
         */
@@ -125,14 +414,554 @@ inline namespace v0
         }
 
     private:
-        static variance_type square_impl(mean_type const & x)
+        template <class X>
+        variance_accumulator & downdate(X const & x)
+        {
+            if(this->count() == 1)
+            {
+                this->S_ *= 0;
+            }
+            else
+            {
+                auto const n = Scalar(this->count());
+
+                tensor_algebra::add_outer_square_of_difference_impl(this->S_, x, this->mean(),
+                                                                    -n, n - 1);
+            }
+
+            this->mean_acc_.remove(x);
+
+            return *this;
+        }
+
+        // Учёт группы элементов, вклад разброса внутри которой уже прибавлен к S_
+        void merge_means(counter_type const & count, mean_type const & mean)
         {
-            return tensor_algebra::outer_square_impl(x);
+            auto const weight = Scalar(this->count()) * Scalar(count);
+
+            tensor_algebra::add_outer_square_of_difference_impl(this->S_, mean, this->mean(),
+                                                                weight, this->count() + count);
+
+            this->mean_acc_.merge(count, mean);
         }
 
         variance_type S_ = variance_type(0.0);
         Mean_acc mean_acc_;
     };
+
+    /** @brief Накопитель для точного вычисления дисперсии целых чисел
+    @tparam T целочисленный тип элементов
+    @tparam IntType тип для представления количества элементов
+    @tparam Tensor_algebra тензорная алгебра, определяет только тип @c tensor_algebra
+    @tparam Accumulation тип среднего и дисперсии
+
+    Хранит количество элементов, их сумму @c S и сумму квадратов @c Q в типе
+    <tt> exact_power_sums_policy::wide_integer </tt>. При 128-битном типе суммы вычисляются точно,
+    если модули элементов не превосходят <tt> 2^31 </tt>, а их количество --- <tt> 2^63 </tt>.
+    При запросе дисперсии сумма квадратов отклонений от ближайшего целого <tt> q <= S/n </tt>
+    вычисляется точно как <tt> Q - q * (S + r) </tt>, где <tt> r = S - q * n </tt>, поэтому
+    преобразование в тип с плавающей точкой не приводит к потере точности из-за вычитания близких
+    чисел.
+    */
+    template <class T, class IntType, template <class> class Tensor_algebra, class Accumulation>
+    class variance_accumulator<T, IntType, Tensor_algebra, exact_power_sums_policy, Accumulation>
+    {
+        static_assert(std::is_integral<T>::value, "Exact power sums require integral type");
+        static_assert(exact_power_sums_policy::supports<T>(),
+                      "Sums of squares of T may overflow exact_power_sums_policy::wide_integer");
+
+    public:
+        /// @brief Тип количества элементов
+        using counter_type = IntType;
+
+        /// @brief Тип среднего
+        using mean_type = Accumulation;
+
+        /// @brief Тип тензорной алгебры
+        using tensor_algebra = Tensor_algebra<mean_type>;
+
+        /// @brief Тип дисперсии
+        using variance_type = mean_type;
+
+        /// @brief Тип для хранения сумм
+        using wide_integer = exact_power_sums_policy::wide_integer;
+
+        /** @brief Конструктор
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == 0 </tt>
+        @post <tt> this->variance() == 0 </tt>
+        */
+        variance_accumulator() = default;
+
+        /** @brief Конструктор с явным заданием "нулевого" элемента
+        @param zero значение, которое возвращают @c mean и @c variance, пока не обработано ни
+        одного элемента
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == zero </tt>
+        @post <tt> this->variance() == zero * zero </tt>
+        */
+        variance_accumulator(mean_type zero)
+         : zero_(std::move(zero))
+        {}
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param x новый элемент
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & operator()(T const & x)
+        {
+            auto const w = static_cast<wide_integer>(x);
+
+            ++ this->n_;
+            this->sum_ += w;
+            this->sum_of_squares_ += w * w;
+
+            return *this;
+        }
+
+        /** @brief Обновление статистик с учётом блока элементов
+        @param first, last интервал, задающий блок элементов
+        @return <tt> *this </tt>
+        */
+        template <class InputIterator>
+        variance_accumulator & update_block(InputIterator first, InputIterator last)
+        {
+            for(; first != last; ++ first)
+            {
+                (*this)(*first);
+            }
+
+            return *this;
+        }
+
+        /** @brief Исключение ранее учтённого элемента
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & remove(T const & x)
+        {
+            auto const w = static_cast<wide_integer>(x);
+
+            -- this->n_;
+            this->sum_ -= w;
+            this->sum_of_squares_ -= w * w;
+
+            return *this;
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @post Состояние <tt> *this </tt> совпадает с состоянием, которое было бы получено, если
+        бы элементы, обработанные @c other, были переданы <tt> *this </tt>
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & merge(variance_accumulator const & other)
+        {
+            this->n_ += other.n_;
+            this->sum_ += other.sum_;
+            this->sum_of_squares_ += other.sum_of_squares_;
+
+            return *this;
+        }
+
+        /** @brief Исключение элементов, учтённых другим накопителем
+        @param other накопитель, элементы которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & subtract(variance_accumulator const & other)
+        {
+            this->n_ -= other.n_;
+            this->sum_ -= other.sum_;
+            this->sum_of_squares_ -= other.sum_of_squares_;
+
+            return *this;
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->n_;
+        }
+
+        /** @brief Сумма элементов
+        @return Точное значение суммы обработанных к настоящему моменту элементов
+        */
+        wide_integer const & sum() const
+        {
+            return this->sum_;
+        }
+
+        /** @brief Сумма квадратов элементов
+        @return Точное значение суммы квадратов обработанных к настоящему моменту элементов
+        */
+        wide_integer const & sum_of_squares() const
+        {
+            return this->sum_of_squares_;
+        }
+
+        /** @brief Среднее значение
+        @return Среднее значение обработанных к настоящему моменту элементов или "нулевой"
+        элемент, если элементов не было
+
+        В отличие от основного шаблона, среднее не хранится, а вычисляется по точной сумме,
+        поэтому возвращается по значению.
+        */
+        mean_type mean() const
+        {
+            if(this->n_ == 0)
+            {
+                return this->zero_;
+            }
+
+            auto const n = static_cast<wide_integer>(this->n_);
+            auto const q = this->floor_mean();
+
+            return static_cast<mean_type>(q) + static_cast<mean_type>(this->sum_ - q * n) / n;
+        }
+
+        /** @brief Дисперсия
+        @return Дисперсия обработанных к настоящему моменту элементов или квадрат "нулевого"
+        элемента, если элементов не было
+        */
+        variance_type variance() const
+        {
+            if(this->n_ == 0)
+            {
+                return this->zero_ * this->zero_;
+            }
+
+            auto const n = static_cast<wide_integer>(this->n_);
+            auto const q = this->floor_mean();
+            auto const r = this->sum_ - q * n;
+
+            // Сумма квадратов отклонений от q, вычисленная точно
+            auto const squares = this->sum_of_squares_ - q * (this->sum_ + r);
+
+            auto const r_n = static_cast<variance_type>(r) / static_cast<variance_type>(n);
+
+            return (static_cast<variance_type>(squares) - static_cast<variance_type>(r) * r_n)
+                   / static_cast<variance_type>(n);
+        }
+
+        /** @brief Среднеквадратическое отклонение
+        @return <tt> sqrt(this->variance()) </tt>
+        */
+        variance_type standard_deviation() const
+        {
+            using std::sqrt;
+            return sqrt(this->variance());
+        }
+
+    private:
+        // Наибольшее целое, не превосходящее среднего
+        wide_integer floor_mean() const
+        {
+            auto const n = static_cast<wide_integer>(this->n_);
+            auto q = this->sum_ / n;
+
+            if(q * n > this->sum_)
+            {
+                -- q;
+            }
+
+            return q;
+        }
+
+        counter_type n_ = counter_type(0);
+        wide_integer sum_ = 0;
+        wide_integer sum_of_squares_ = 0;
+        mean_type zero_ = mean_type(0);
+    };
+
+    /** @brief Накопитель для вычисления дисперсии с компенсацией ошибок округления
+    @tparam T тип элементов
+    @tparam IntType тип для представления количества элементов
+    @tparam Tensor_algebra используемая тензорная алгебра
+    @tparam Accumulation тип, в котором хранятся среднее и поправка к нему
+
+    Использует те же формулы обновления, что и метод Уэлфорда, но приращения среднего и суммы
+    квадратов отклонений (для векторов --- каждого элемента упакованной матрицы) прибавляются по
+    алгоритму Ноймайера, а отклонения вычисляются относительно среднего с учётом поправки. Это
+    позволяет хранить, например, матрицу ковариаций в @c float и получать результаты, точность
+    которых близка к точности вычислений в @c double, ценой хранения второй матрицы.
+    */
+    template <class T, class IntType, template <class> class Tensor_algebra, class Accumulation>
+    class variance_accumulator<T, IntType, Tensor_algebra, compensated_sum_policy, Accumulation>
+    {
+    public:
+        /// @brief Тип количества элементов
+        using counter_type = IntType;
+
+        /// @brief Тип среднего
+        using mean_type = Accumulation;
+
+        /// @brief Тип тензорной алгебры
+        using tensor_algebra = Tensor_algebra<mean_type>;
+
+        /// @brief Тип дисперсии
+        using variance_type = average_type_t<typename tensor_algebra::tensor_product_type, IntType>;
+
+        /** @brief Конструктор
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == T(0) </tt>
+        @post <tt> this->variance() == T(0) </tt>
+        */
+        variance_accumulator() = default;
+
+        /** @brief Конструктор
+        @param zero "нулевой" элемент
+        @post <tt> this->count() == 0 </tt>
+        @post <tt> this->mean() == zero </tt>
+        @post <tt> this->variance() == zero * zero </tt>, где * обозначает тензорное произведение
+        */
+        variance_accumulator(mean_type zero)
+         : S_(tensor_algebra::outer_square_impl(zero))
+         , S_lo_(S_)
+         , mean_(zero)
+         , mean_lo_(std::move(zero))
+        {}
+
+        /** @brief Обновление статистик с учётом нового элемента
+        @param x новый элемент
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & operator()(T const & x)
+        {
+            return this->update(x);
+        }
+
+        /** @brief Обновление статистик с учётом нового элемента, заданного вектором другого типа
+        @param x новый элемент, например, представление данных, хранящихся во внешнем буфере
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, variance_accumulator &>
+        operator()(Vector const & x)
+        {
+            return this->update(x);
+        }
+
+        /** @brief Обновление статистик с учётом блока элементов
+        @param first, last интервал, задающий блок элементов
+        @return <tt> *this </tt>
+        */
+        template <class InputIterator>
+        variance_accumulator & update_block(InputIterator first, InputIterator last)
+        {
+            for(; first != last; ++ first)
+            {
+                (*this)(*first);
+            }
+
+            return *this;
+        }
+
+        /** @brief Исключение ранее учтённого элемента
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & remove(T const & x)
+        {
+            return this->downdate(x);
+        }
+
+        /** @brief Исключение ранее учтённого элемента, заданного вектором другого типа
+        @param x элемент, который ранее был передан <tt> operator() </tt>
+        @pre <tt> this->count() > 0 </tt>
+        @pre <tt> x.dim() == this->mean().dim() </tt>
+        @return <tt> *this </tt>
+        */
+        template <class Vector>
+        std::enable_if_t<details::is_other_vector<T, Vector>::value, variance_accumulator &>
+        remove(Vector const & x)
+        {
+            return this->downdate(x);
+        }
+
+        /** @brief Объединение с другим накопителем
+        @param other накопитель, статистики которого нужно учесть
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & merge(variance_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(this->count() == 0)
+            {
+                *this = other;
+                return *this;
+            }
+
+            return this->combine(other, 1);
+        }
+
+        /** @brief Исключение элементов, учтённых другим накопителем
+        @param other накопитель, элементы которого ранее были учтены <tt> *this </tt>
+        @pre <tt> other.count() <= this->count() </tt>
+        @return <tt> *this </tt>
+        */
+        variance_accumulator & subtract(variance_accumulator const & other)
+        {
+            if(other.count() == 0)
+            {
+                return *this;
+            }
+
+            if(other.count() == this->count())
+            {
+                details::check_equal_dimensions(this->mean_, other.mean_, 0);
+
+                this->reset();
+                return *this;
+            }
+
+            return this->combine(other, -1);
+        }
+
+        /** @brief Количество элементов
+        @return Количество обработанных к настоящему моменту элементов
+        */
+        counter_type const & count() const
+        {
+            return this->n_;
+        }
+
+        /** @brief Среднее значение
+        @return Накопленное к настоящему моменту среднее значение с учётом поправки
+        */
+        mean_type mean() const
+        {
+            return details::compensated_value(this->mean_, this->mean_lo_, 0);
+        }
+
+        /** @brief Дисперсия
+        @return Накопленное к настоящему моменту значение дисперсии с учётом поправки
+        */
+        variance_type variance() const
+        {
+            auto result = details::compensated_value(this->S_, this->S_lo_, 0);
+
+            if(this->n_ != 0)
+            {
+                result /= this->n_;
+            }
+
+            return result;
+        }
+
+        /** @brief Среднеквадратическое отклонение
+        @return <tt> sqrt(this->variance()) </tt>
+        */
+        variance_type standard_deviation() const
+        {
+            using std::sqrt;
+            return sqrt(this->variance());
+        }
+
+    private:
+        // Тип весов: тип элементов среднего, но не менее точный, чем double
+        using Weight = decltype(std::declval<details::scalar_type_t<mean_type>>() * 1.0);
+
+        // Отклонение элемента x от среднего с учётом поправки
+        template <class X>
+        auto deviation_from(X const & x) const
+        {
+            return [this, &x](auto i)
+            {
+                return (details::element_at(x, i, 0) - details::element_at(this->mean_, i, 0))
+                       - details::element_at(this->mean_lo_, i, 0);
+            };
+        }
+
+        template <class X>
+        variance_accumulator & update(X const & x)
+        {
+            details::check_equal_dimensions(this->mean_, x, 0);
+
+            ++ this->n_;
+
+            auto const n = Weight(this->n_);
+
+            details::add_compensated_moments(this->S_, this->S_lo_, this->mean_, this->mean_lo_,
+                                             this->deviation_from(x), (n - 1) / n, 1 / n, 0);
+
+            return *this;
+        }
+
+        template <class X>
+        variance_accumulator & downdate(X const & x)
+        {
+            details::check_equal_dimensions(this->mean_, x, 0);
+
+            if(this->n_ == 1)
+            {
+                this->reset();
+                return *this;
+            }
+
+            auto const n = Weight(this->n_);
+
+            details::add_compensated_moments(this->S_, this->S_lo_, this->mean_, this->mean_lo_,
+                                             this->deviation_from(x), -n / (n - 1), -1 / (n - 1),
+                                             0);
+
+            -- this->n_;
+
+            return *this;
+        }
+
+        // При sign == 1 --- объединение, при sign == -1 --- вычитание
+        variance_accumulator & combine(variance_accumulator const & other, int sign)
+        {
+            details::check_equal_dimensions(this->mean_, other.mean_, 0);
+
+            auto const n = Weight(this->n_);
+            auto const k = Weight(other.n_);
+            auto const total = n + sign * k;
+
+            details::add_compensated(this->S_, this->S_lo_, other.S_, sign, 0);
+            details::add_compensated(this->S_, this->S_lo_, other.S_lo_, sign, 0);
+
+            auto const deviation = [this, &other](auto i)
+            {
+                return (details::element_at(other.mean_, i, 0)
+                        - details::element_at(this->mean_, i, 0))
+                       + (details::element_at(other.mean_lo_, i, 0)
+                          - details::element_at(this->mean_lo_, i, 0));
+            };
+
+            details::add_compensated_moments(this->S_, this->S_lo_, this->mean_, this->mean_lo_,
+                                             deviation, sign * n * k / total, sign * k / total, 0);
+
+            this->n_ += sign * other.n_;
+
+            return *this;
+        }
+
+        void reset()
+        {
+            this->n_ = counter_type(0);
+            this->S_ *= 0;
+            this->S_lo_ *= 0;
+            this->mean_ *= 0;
+            this->mean_lo_ *= 0;
+        }
+
+        counter_type n_ = counter_type(0);
+        variance_type S_ = variance_type(0.0);
+        variance_type S_lo_ = variance_type(0.0);
+        mean_type mean_ = mean_type(0);
+        mean_type mean_lo_ = mean_type(0);
+    };
 }
 // namespace v0
 }
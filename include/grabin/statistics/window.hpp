@@ -0,0 +1,509 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_STATISTICS_WINDOW_HPP_INCLUDED
+#define Z_GRABIN_STATISTICS_WINDOW_HPP_INCLUDED
+
+/** @file grabin/statistics/window.hpp
+ @brief Накопители статистик по скользящему окну
+*/
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace grabin
+{
+inline namespace v0
+{
+namespace details
+{
+    // Кольцевой буфер: освободившиеся элементы не уничтожаются, а повторно используются
+    // присваиванием, поэтому в установившемся режиме память не выделяется. Если буфер заполнен, то
+    // элементы переставляются так, чтобы первый элемент был в начале хранилища, и новый элемент
+    // добавляется в его конец.
+    template <class T>
+    class ring_buffer
+    {
+    public:
+        using size_type = std::size_t;
+
+        explicit ring_buffer(size_type capacity)
+        {
+            this->data_.reserve(capacity);
+        }
+
+        // Значение не должно ссылаться на элементы буфера
+        template <class U>
+        void push_back(U && value)
+        {
+            if(this->size_ < this->data_.size())
+            {
+                (*this)[this->size_] = std::forward<U>(value);
+            }
+            else
+            {
+                std::rotate(this->data_.begin(), this->data_.begin() + this->head_,
+                            this->data_.end());
+                this->head_ = 0;
+
+                this->data_.emplace_back(std::forward<U>(value));
+            }
+
+            ++ this->size_;
+        }
+
+        void pop_front()
+        {
+            this->head_ = (this->head_ + 1 == this->data_.size()) ? 0 : this->head_ + 1;
+            -- this->size_;
+        }
+
+        T & operator[](size_type index)
+        {
+            return this->data_[this->position(index)];
+        }
+
+        T const & operator[](size_type index) const
+        {
+            return this->data_[this->position(index)];
+        }
+
+        T const & front() const
+        {
+            return this->data_[this->head_];
+        }
+
+        size_type size() const
+        {
+            return this->size_;
+        }
+
+        bool empty() const
+        {
+            return this->size_ == 0;
+        }
+
+    private:
+        size_type position(size_type index) const
+        {
+            auto const result = this->head_ + index;
+            return result < this->data_.size() ? result : result - this->data_.size();
+        }
+
+        std::vector<T> data_;
+        size_type head_ = 0;
+        size_type size_ = 0;
+    };
+
+    template <class Accumulator, class Tuple, std::size_t... I>
+    void remove_sample(Accumulator & acc, Tuple const & sample, std::index_sequence<I...>)
+    {
+        acc.remove(std::get<I>(sample)...);
+    }
+}
+// namespace details
+
+    /** @brief Функциональный объект для определения наименьшего из двух значений
+    @tparam Compare функция сравнения
+    */
+    template <class Compare = std::less<>>
+    struct minimum
+    {
+        /** @brief Наименьшее из двух значений
+        @param x, y аргументы
+        @return <tt> Compare{}(y, x) ? y : x </tt>
+        */
+        template <class T>
+        T const & operator()(T const & x, T const & y) const
+        {
+            return Compare{}(y, x) ? y : x;
+        }
+    };
+
+    /** @brief Функциональный объект для определения наибольшего из двух значений
+    @tparam Compare функция сравнения
+    */
+    template <class Compare = std::less<>>
+    struct maximum
+    {
+        /** @brief Наибольшее из двух значений
+        @param x, y аргументы
+        @return <tt> Compare{}(x, y) ? y : x </tt>
+        */
+        template <class T>
+        T const & operator()(T const & x, T const & y) const
+        {
+            return Compare{}(x, y) ? y : x;
+        }
+    };
+
+    /** @brief Накопитель свёртки элементов очереди с помощью ассоциативной операции
+    @tparam T тип элементов
+    @tparam BinaryOperation ассоциативная бинарная операция
+
+    Предназначен для статистик, которые нельзя обновить при исключении элемента, например,
+    наименьшего и наибольшего значений. Элементы исключаются в порядке добавления. Очередь
+    реализована двумя стеками: для элементов "выходного" стека хранятся свёртки суффиксов, для
+    "входного" --- свёртки префиксов. Когда выходной стек опустошается, входной стек переносится
+    в него за время, пропорциональное количеству элементов, поэтому добавление, исключение и
+    получение результата выполняются за амортизированное постоянное время.
+    */
+    template <class T, class BinaryOperation>
+    class queue_fold_accumulator
+    {
+    public:
+        /// @brief Тип количества элементов
+        using size_type = std::size_t;
+
+        /// @brief Тип результата
+        using value_type = T;
+
+        /** @brief Конструктор
+        @param capacity количество элементов, для которого память выделяется заранее
+        @param op ассоциативная бинарная операция
+        @post <tt> this->count() == 0 </tt>
+        */
+        explicit queue_fold_accumulator(size_type capacity = 0,
+                                        BinaryOperation op = BinaryOperation())
+         : items_(capacity)
+         , op_(std::move(op))
+        {}
+
+        /** @brief Добавление элемента в конец очереди
+        @param x новый элемент
+        @return <tt> *this </tt>
+        */
+        queue_fold_accumulator & operator()(T const & x)
+        {
+            if(this->items_.size() == this->split_)
+            {
+                this->items_.push_back(std::pair<T const &, T const &>(x, x));
+            }
+            else
+            {
+                T const back = this->op_(this->items_[this->items_.size() - 1].second, x);
+                this->items_.push_back(std::pair<T const &, T const &>(x, back));
+            }
+
+            return *this;
+        }
+
+        /** @brief Исключение первого элемента очереди
+        @param x исключаемый элемент, используется только для единообразия с накопителями,
+        допускающими исключение произвольного элемента
+        @pre <tt> this->count() > 0 </tt>
+        @pre @c x совпадает с самым ранним из учтённых элементов
+        @return <tt> *this </tt>
+        */
+        queue_fold_accumulator & remove(T const & x)
+        {
+            static_cast<void>(x);
+
+            if(this->split_ == 0)
+            {
+                this->flip();
+            }
+
+            this->items_.pop_front();
+            -- this->split_;
+
+            return *this;
+        }
+
+        /** @brief Количество элементов
+        @return Количество элементов в очереди
+        */
+        size_type count() const
+        {
+            return this->items_.size();
+        }
+
+        /** @brief Результат свёртки
+        @pre <tt> this->count() > 0 </tt>
+        @return <tt> op(...op(op(x_0, x_1), x_2)..., x_{n-1}) </tt>, где
+        <tt> x_0, ..., x_{n-1} </tt> --- элементы очереди в порядке добавления
+        */
+        T value() const
+        {
+            auto const & back = this->items_[this->items_.size() - 1].second;
+
+            if(this->split_ == 0)
+            {
+                return back;
+            }
+            else if(this->split_ == this->items_.size())
+            {
+                return this->items_.front().second;
+            }
+            else
+            {
+                return this->op_(this->items_.front().second, back);
+            }
+        }
+
+    private:
+        void flip()
+        {
+            this->split_ = this->items_.size();
+
+            auto & last = this->items_[this->split_ - 1];
+            last.second = last.first;
+
+            for(auto i = this->split_ - 1; i > 0; -- i)
+            {
+                auto & item = this->items_[i - 1];
+                item.second = this->op_(item.first, this->items_[i].second);
+            }
+        }
+
+        // Пары "элемент, свёртка": первые split_ элементов образуют выходной стек и хранят
+        // свёртки суффиксов этого стека, остальные --- входной стек и хранят свёртки его префиксов
+        details::ring_buffer<std::pair<T, T>> items_;
+        size_type split_ = 0;
+        BinaryOperation op_;
+    };
+
+    /** @brief Накопитель наименьшего значения элементов очереди
+    @tparam T тип элементов
+    @tparam Compare функция сравнения
+    */
+    template <class T, class Compare = std::less<>>
+    using queue_min_accumulator = queue_fold_accumulator<T, minimum<Compare>>;
+
+    /** @brief Накопитель наибольшего значения элементов очереди
+    @tparam T тип элементов
+    @tparam Compare функция сравнения
+    */
+    template <class T, class Compare = std::less<>>
+    using queue_max_accumulator = queue_fold_accumulator<T, maximum<Compare>>;
+
+    /** @brief Накопитель статистик по последним @c W элементам
+    @tparam Accumulator тип накопителя, поддерживающего исключение ранее учтённых элементов с
+    помощью функции-члена @c remove
+    @tparam Sample типы аргументов, задающих один элемент выборки
+
+    Элементы окна хранятся в кольцевом буфере, память для которого выделяется при создании.
+    Новый элемент передаётся накопителю, а элемент, вышедший за пределы окна, исключается из
+    него, поэтому время обновления не зависит от размера окна.
+    */
+    template <class Accumulator, class... Sample>
+    class sliding_window_accumulator
+    {
+    public:
+        /// @brief Тип накопителя
+        using accumulator_type = Accumulator;
+
+        /// @brief Тип количества элементов
+        using size_type = std::size_t;
+
+        /** @brief Конструктор
+        @param window размер окна
+        @param acc накопитель, которому не передавались элементы
+        @throw logic_error, если <tt> window == 0 </tt>
+        @post <tt> this->size() == 0 </tt>
+        @post <tt> this->window_size() == window </tt>
+        */
+        explicit sliding_window_accumulator(size_type window, Accumulator acc = Accumulator())
+         : acc_(std::move(acc))
+         , samples_(window)
+         , window_(window)
+        {
+            if(window == 0)
+            {
+                throw std::logic_error("Window size must be positive");
+            }
+        }
+
+        /** @brief Добавление нового элемента
+        @param sample аргументы, задающие новый элемент
+        @return <tt> *this </tt>
+        @post Если окно было заполнено, то самый ранний из элементов окна исключён из него
+        */
+        sliding_window_accumulator & operator()(Sample const & ... sample)
+        {
+            if(this->samples_.size() == this->window_)
+            {
+                details::remove_sample(this->acc_, this->samples_.front(),
+                                       std::index_sequence_for<Sample...>{});
+                this->samples_.pop_front();
+            }
+
+            this->acc_(sample...);
+            this->samples_.push_back(std::tie(sample...));
+
+            return *this;
+        }
+
+        /** @brief Накопитель
+        @return Накопитель, которому переданы элементы окна
+        */
+        Accumulator const & accumulator() const
+        {
+            return this->acc_;
+        }
+
+        /** @brief Количество элементов в окне
+        @return <tt> min(n, this->window_size()) </tt>, где @c n --- количество добавленных
+        элементов
+        */
+        size_type size() const
+        {
+            return this->samples_.size();
+        }
+
+        /** @brief Размер окна
+        @return Размер окна, заданный при создании
+        */
+        size_type window_size() const
+        {
+            return this->window_;
+        }
+
+    private:
+        Accumulator acc_;
+        details::ring_buffer<std::tuple<Sample...>> samples_;
+        size_type window_;
+    };
+
+    /** @brief Накопитель статистик по элементам, поступившим в течение заданного промежутка
+    времени
+    @tparam Accumulator тип накопителя, поддерживающего исключение ранее учтённых элементов с
+    помощью функции-члена @c remove
+    @tparam Time тип моментов времени, например, <tt> std::chrono::steady_clock::time_point </tt>
+    @tparam Sample типы аргументов, задающих один элемент выборки
+
+    Окно содержит элементы, моменты поступления которых больше, чем <tt> now - span </tt>, где
+    @c now --- последний известный момент времени. Элементы хранятся в кольцевом буфере, который
+    увеличивается только при превышении наибольшего количества элементов в окне, достигнутого ранее.
+    */
+    template <class Accumulator, class Time, class... Sample>
+    class time_window_accumulator
+    {
+    public:
+        /// @brief Тип накопителя
+        using accumulator_type = Accumulator;
+
+        /// @brief Тип количества элементов
+        using size_type = std::size_t;
+
+        /// @brief Тип моментов времени
+        using time_type = Time;
+
+        /// @brief Тип продолжительности окна
+        using duration_type = decltype(std::declval<Time>() - std::declval<Time>());
+
+        /** @brief Конструктор
+        @param span продолжительность окна
+        @param acc накопитель, которому не передавались элементы
+        @param capacity количество элементов, для которого память выделяется заранее
+        @throw logic_error, если продолжительность окна не положительна
+        @post <tt> this->size() == 0 </tt>
+        @post <tt> this->span() == span </tt>
+        */
+        explicit time_window_accumulator(duration_type span, Accumulator acc = Accumulator(),
+                                         size_type capacity = 0)
+         : acc_(std::move(acc))
+         , samples_(capacity)
+         , span_(span)
+        {
+            if(!(duration_type() < span))
+            {
+                throw std::logic_error("Window span must be positive");
+            }
+        }
+
+        /** @brief Добавление нового элемента
+        @param time момент поступления элемента
+        @param sample аргументы, задающие новый элемент
+        @pre @c time не меньше моментов поступления ранее добавленных элементов
+        @return <tt> *this </tt>
+        @post Элементы, вышедшие за пределы окна к моменту @c time, исключены из него
+        */
+        time_window_accumulator & operator()(Time const & time, Sample const & ... sample)
+        {
+            this->expire(time);
+
+            this->acc_(sample...);
+            this->samples_.push_back(std::tie(time, sample...));
+
+            return *this;
+        }
+
+        /** @brief Исключение элементов, вышедших за пределы окна
+        @param now текущий момент времени
+        @pre @c now не меньше моментов поступления ранее добавленных элементов
+        @return <tt> *this </tt>
+        @post Все элементы окна поступили позже, чем <tt> now - this->span() </tt>
+        */
+        time_window_accumulator & expire(Time const & now)
+        {
+            while(!this->samples_.empty()
+                  && !(now - std::get<0>(this->samples_.front()) < this->span_))
+            {
+                details::remove_sample(this->acc_, this->samples_.front(),
+                                       make_sample_indices{});
+                this->samples_.pop_front();
+            }
+
+            return *this;
+        }
+
+        /** @brief Накопитель
+        @return Накопитель, которому переданы элементы окна
+        */
+        Accumulator const & accumulator() const
+        {
+            return this->acc_;
+        }
+
+        /** @brief Количество элементов в окне
+        @return Количество элементов, поступивших в течение последнего промежутка времени
+        */
+        size_type size() const
+        {
+            return this->samples_.size();
+        }
+
+        /** @brief Продолжительность окна
+        @return Продолжительность окна, заданная при создании
+        */
+        duration_type const & span() const
+        {
+            return this->span_;
+        }
+
+    private:
+        // Номера аргументов элемента выборки в кортеже, начинающемся с момента поступления
+        template <std::size_t... I>
+        static std::index_sequence<(I + 1)...> shift_indices(std::index_sequence<I...>);
+
+        using make_sample_indices
+            = decltype(shift_indices(std::index_sequence_for<Sample...>{}));
+
+        Accumulator acc_;
+        details::ring_buffer<std::tuple<Time, Sample...>> samples_;
+        duration_type span_;
+    };
+}
+// namespace v0
+}
+// namespace grabin
+
+#endif
+// Z_GRABIN_STATISTICS_WINDOW_HPP_INCLUDED
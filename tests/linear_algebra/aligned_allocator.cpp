@@ -0,0 +1,87 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/aligned_allocator.hpp>
+#include <grabin/linear_algebra/math_vector.hpp>
+
+#include <catch/catch.hpp>
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+namespace
+{
+    template <class T>
+    bool is_aligned(T const * p, std::size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+    }
+}
+
+TEST_CASE("aligned_allocator : blocks are aligned")
+{
+    grabin::aligned_allocator<double> alloc;
+    grabin::aligned_allocator<char, 128> char_alloc;
+
+    static_assert(grabin::aligned_allocator<double>::alignment == 64, "");
+
+    for(auto n : {1, 2, 3, 7, 8, 9, 100, 1000})
+    {
+        auto const p = alloc.allocate(n);
+        CHECK(is_aligned(p, 64));
+
+        for(auto i = 0; i < n; ++ i)
+        {
+            p[i] = i;
+        }
+
+        alloc.deallocate(p, n);
+
+        auto const q = char_alloc.allocate(n);
+        CHECK(is_aligned(q, 128));
+        char_alloc.deallocate(q, n);
+    }
+
+    CHECK(alloc == grabin::aligned_allocator<double>(grabin::aligned_allocator<char>()));
+    CHECK(!(alloc != grabin::aligned_allocator<double>()));
+}
+
+TEST_CASE("aligned_allocator : usage with standard containers")
+{
+    std::vector<float, grabin::aligned_allocator<float>> xs;
+    std::list<int, grabin::aligned_allocator<int>> ys{1, 2, 3};
+
+    for(auto i = 0; i < 100; ++ i)
+    {
+        xs.push_back(i);
+        CHECK(is_aligned(xs.data(), 64));
+    }
+
+    CHECK(ys.size() == 3);
+}
+
+TEST_CASE("aligned_math_vector : storage is aligned")
+{
+    grabin::aligned_math_vector<double> x(13);
+    grabin::aligned_math_vector<double> const y{1.0, 2.0, 3.0};
+
+    CHECK(is_aligned(x.data(), 64));
+    CHECK(is_aligned(y.data(), 64));
+
+    x = 2.0 * grabin::aligned_math_vector<double>(31);
+    CHECK(x.dim() == 31);
+    CHECK(is_aligned(x.data(), 64));
+}
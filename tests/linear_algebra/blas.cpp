@@ -0,0 +1,308 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/blas.hpp>
+
+#include <grabin/linear_algebra/math_vector.hpp>
+#include <grabin/linear_algebra/math_vector_view.hpp>
+#include <grabin/linear_algebra/static_math_vector.hpp>
+#include <grabin/linear_algebra/symmetric_matrix.hpp>
+
+#include "test_data.hpp"
+
+#include <catch/catch.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    template <class Matrix, class Vector1, class Vector2>
+    grabin::math_vector<double>
+    naive_symv(double alpha, Matrix const & A, Vector1 const & x, double beta, Vector2 const & y)
+    {
+        grabin::math_vector<double> result(A.dim());
+
+        for(auto i = 0*A.dim(); i < A.dim(); ++ i)
+        {
+            auto sum = 0.0;
+
+            for(auto j = 0*A.dim(); j < A.dim(); ++ j)
+            {
+                sum += A(i, j) * x[j];
+            }
+
+            result[i] = alpha * sum + beta * y[i];
+        }
+
+        return result;
+    }
+
+    std::vector<grabin::summation_mode> all_summation_modes()
+    {
+        return {grabin::summation_mode::lanewise, grabin::summation_mode::pairwise,
+                grabin::summation_mode::compensated};
+    }
+}
+
+TEST_CASE("blas : dot for vectors, views and expressions")
+{
+    grabin::math_vector<double> const x{1, 2, 3};
+    grabin::math_vector<double> const y{4, 5, 6};
+
+    for(auto mode : all_summation_modes())
+    {
+        CHECK(grabin::dot(x, y, mode) == 32.0);
+        CHECK(grabin::dot(grabin::make_math_vector_view(x.data(), 3), y, mode) == 32.0);
+        CHECK(grabin::dot(x + y, x, mode) == 5.0 + 14.0 + 27.0);
+    }
+
+    grabin::static_math_vector<int, 3> const a{1, -2, 3};
+    CHECK(grabin::dot(a, a) == 14);
+
+    std::vector<double> table{1, 10, 2, 20, 3, 30};
+    CHECK(grabin::dot(grabin::make_strided_vector_view(table.data(), 3, 2), y) == 32.0);
+
+    CHECK_THROWS_AS(grabin::dot(x, grabin::math_vector<double>(2)), std::logic_error);
+}
+
+TEST_CASE("blas : views give the same results as contiguous vectors")
+{
+    auto const n = 1500;
+
+    auto const x = grabin_test::make_test_vector(n, 0.25);
+    auto const y = grabin_test::make_test_vector(n, -1.5);
+
+    std::vector<double> table(2 * n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        table[2 * i] = x[i];
+    }
+
+    auto const x_strided = grabin::make_strided_vector_view(table.data(), n, 2);
+
+    for(auto mode : all_summation_modes())
+    {
+        CAPTURE(static_cast<int>(mode));
+
+        CHECK(grabin::dot(x_strided, y, mode) == grabin::dot(x, y, mode));
+        CHECK(grabin::asum(x_strided, mode) == grabin::asum(x, mode));
+        CHECK(grabin::nrm2(x_strided, mode) == grabin::nrm2(x, mode));
+    }
+
+    CHECK(grabin::iamax(x_strided) == grabin::iamax(x));
+}
+
+TEST_CASE("blas : asum, nrm2 and iamax")
+{
+    grabin::math_vector<double> const x{3, -4, 0, 4};
+
+    CHECK(grabin::asum(x) == 11.0);
+    CHECK(grabin::nrm2(x) == Approx(std::sqrt(41.0)));
+    CHECK(grabin::iamax(x) == 1);
+
+    grabin::math_vector<double> const empty(0);
+    CHECK(grabin::asum(empty) == 0.0);
+    CHECK(grabin::nrm2(empty) == 0.0);
+    CHECK(grabin::iamax(empty) == empty.dim());
+
+    grabin::static_math_vector<int, 4> const a{1, -7, 7, 3};
+    CHECK(grabin::asum(a) == 18);
+    CHECK(grabin::iamax(a) == 1);
+}
+
+TEST_CASE("blas : nrm2 does not overflow or underflow")
+{
+    for(auto mode : all_summation_modes())
+    {
+        grabin::math_vector<double> const big{3e200, -4e200};
+        CHECK(grabin::nrm2(big, mode) == Approx(5e200));
+
+        grabin::math_vector<double> const small{3e-200, -4e-200};
+        CHECK(grabin::nrm2(small, mode) == Approx(5e-200));
+
+        grabin::math_vector<double> const zero(5);
+        CHECK(grabin::nrm2(zero, mode) == 0.0);
+    }
+
+    auto const inf = std::numeric_limits<double>::infinity();
+    CHECK(grabin::nrm2(grabin::math_vector<double>{1.0, -inf}) == inf);
+    CHECK(std::isnan(grabin::nrm2(grabin::math_vector<double>{1.0, std::nan("")})));
+}
+
+TEST_CASE("blas : compensated summation")
+{
+    grabin::math_vector<double> const ones{1, 1, 1};
+    grabin::math_vector<double> const x{1e16, 1, -1e16};
+
+    CHECK(grabin::dot(x, ones, grabin::summation_mode::compensated) == 1.0);
+    CHECK(grabin::asum(grabin::math_vector<double>{1e16, 1, 1}, grabin::summation_mode::compensated)
+          == 1e16 + 2);
+
+    // Погрешность округления произведения тоже учитывается
+    auto const a = 1.0 + std::ldexp(1.0, -30);
+    auto const a2 = a * a;
+
+    grabin::math_vector<double> const u{a, -1};
+    grabin::math_vector<double> const v{a, a2};
+
+    CHECK(grabin::dot(u, v, grabin::summation_mode::compensated) == std::ldexp(1.0, -60));
+}
+
+TEST_CASE("blas : pairwise summation of a long vector")
+{
+    auto const n = 1000000;
+    grabin::math_vector<float> x(n);
+
+    for(auto & each : x)
+    {
+        each = 0.1f;
+    }
+
+    auto const expected = static_cast<double>(0.1f) * n;
+
+    auto const lanewise = grabin::asum(x);
+    auto const pairwise = grabin::asum(x, grabin::summation_mode::pairwise);
+
+    CHECK(std::abs(pairwise - expected) <= std::abs(lanewise - expected));
+    CHECK(pairwise == Approx(expected).epsilon(1e-6));
+
+    grabin::math_vector<double> y(n);
+
+    for(auto & each : y)
+    {
+        each = 0.1;
+    }
+
+    auto const exact = static_cast<long double>(0.1) * n;
+    auto const compensated = grabin::asum(y, grabin::summation_mode::compensated);
+
+    CHECK(std::abs(compensated - exact) <= std::abs(grabin::asum(y) - exact));
+    CHECK(compensated == static_cast<double>(exact));
+}
+
+TEST_CASE("blas : axpy")
+{
+    auto const x = grabin_test::make_test_vector(37, 0.25);
+    auto const y = grabin_test::make_test_vector(37, -1.5);
+    auto const a = 1.0 / 3;
+
+    grabin::math_vector<double> expected = y + a * x;
+
+    auto z = y;
+    grabin::axpy(a, x, z);
+    CHECK(z == expected);
+
+    std::vector<double> table(2 * 37);
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        table[2 * i + 1] = y[i];
+    }
+
+    grabin::axpy(a, x, grabin::make_strided_vector_view(table.data() + 1, 37, 2));
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        CHECK(table[2 * i] == 0.0);
+        CHECK(table[2 * i + 1] == expected[i]);
+    }
+
+    CHECK_THROWS_AS(grabin::axpy(a, x, grabin::math_vector<double>(3)), std::logic_error);
+}
+
+TEST_CASE("blas : symv over packed and padded storage")
+{
+    auto const n = 45;
+
+    auto const A = grabin_test::make_test_matrix<grabin::symmetric_matrix<double>>(n);
+    auto const A_aligned = grabin_test::make_test_matrix<grabin::aligned_symmetric_matrix<double>>(n);
+
+    auto const x = grabin_test::make_test_vector(n, 0.25);
+    auto const y0 = grabin_test::make_test_vector(n, -1.5);
+
+    auto const expected = naive_symv(0.5, A, x, 2.0, y0);
+
+    auto y = y0;
+    grabin::symv(0.5, A, x, 2.0, y);
+
+    auto y_aligned = y0;
+    grabin::symv(0.5, A_aligned, x, 2.0, y_aligned);
+
+    CHECK(y_aligned == y);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(y[i] == Approx(expected[i]));
+    }
+
+    // Непрерывные и разреженные вектора дают одинаковый результат
+    std::vector<double> table(2 * n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        table[2 * i] = x[i];
+        table[2 * i + 1] = y0[i];
+    }
+
+    grabin::symv(0.5, A, grabin::make_strided_vector_view(table.data(), n, 2), 2.0,
+                 grabin::make_strided_vector_view(table.data() + 1, n, 2));
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(table[2 * i] == x[i]);
+        CHECK(table[2 * i + 1] == y[i]);
+    }
+}
+
+TEST_CASE("blas : symv special coefficients and operator")
+{
+    auto const n = 7;
+    auto const A = grabin_test::make_test_matrix<grabin::symmetric_matrix<double>>(n);
+    auto const x = grabin_test::make_test_vector(n, 0.25);
+
+    // При beta == 0 исходные значения y не используются
+    grabin::math_vector<double> y(n);
+
+    for(auto & each : y)
+    {
+        each = std::nan("");
+    }
+
+    grabin::symv(1.0, A, x, 0.0, y);
+
+    CHECK(A * x == y);
+
+    auto const zero = naive_symv(1.0, A, x, 0.0, y);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(y[i] == Approx(zero[i]));
+    }
+
+    // При alpha == 0 матрица не используется
+    auto z = x;
+    grabin::symv(0.0, A, x, 3.0, z);
+    CHECK(z == 3.0 * x);
+
+    CHECK((2.0 * A * x)[0] == Approx(2.0 * y[0]));
+    CHECK((A * 2.0)(1, 0) == 2.0 * A(1, 0));
+
+    CHECK_THROWS_AS(A * grabin::math_vector<double>(3), std::logic_error);
+    CHECK_THROWS_AS(grabin::symv(1.0, A, x, 0.0, grabin::math_vector<double>(3)),
+                    std::logic_error);
+}
@@ -0,0 +1,291 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/cholesky.hpp>
+
+#include <grabin/linear_algebra/math_vector_view.hpp>
+
+#include "test_data.hpp"
+
+#include <catch/catch.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    // Положительно определённая матрица M * M^T + n * I
+    template <class Matrix>
+    Matrix make_positive_definite(typename Matrix::dimension_type n)
+    {
+        auto const m = [](double i, double k) { return std::sin(i * 0.7 + k * 1.3); };
+
+        Matrix A(n);
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            for(auto j = 0*n; j <= i; ++ j)
+            {
+                auto sum = (i == j) ? double(n) : 0.0;
+
+                for(auto k = 0*n; k < 5; ++ k)
+                {
+                    sum += m(i, k) * m(j, k);
+                }
+
+                A(i, j) = sum;
+            }
+        }
+
+        return A;
+    }
+
+    // Разложение без разбиения на полосы, с тем же порядком операций для каждого элемента
+    void reference_cholesky(grabin::symmetric_matrix<double> & A)
+    {
+        for(auto i = 0*A.dim(); i < A.dim(); ++ i)
+        {
+            auto const row_i = A.row_data(i);
+
+            for(auto j = 0*i; j < i; ++ j)
+            {
+                auto const row_j = A.row_data(j);
+                row_i[j] = (row_i[j] - grabin::simd::dot(row_i, row_j, j)) / row_j[j];
+            }
+
+            row_i[i] = std::sqrt(row_i[i] - grabin::simd::dot(row_i, row_i, i));
+        }
+    }
+}
+
+TEST_CASE("cholesky : factorization of a large matrix")
+{
+    // Размерность выбрана так, чтобы строки обрабатывались несколькими полосами
+    auto const n = 260;
+
+    auto const A = make_positive_definite<grabin::symmetric_matrix<double>>(n);
+
+    auto L = A;
+    grabin::cholesky_factorize(L);
+
+    auto L_reference = A;
+    reference_cholesky(L_reference);
+
+    CHECK(std::equal(L.begin(), L.end(), L_reference.begin()));
+
+    auto L_aligned = make_positive_definite<grabin::aligned_symmetric_matrix<double>>(n);
+    grabin::cholesky_factorize(L_aligned);
+
+    CHECK(std::equal(L.begin(), L.end(), L_aligned.begin()));
+
+    for(auto i = 0*n; i < n; i += 7)
+    {
+        for(auto j = 0*n; j <= i; ++ j)
+        {
+            auto sum = 0.0;
+
+            for(auto k = 0*n; k <= j; ++ k)
+            {
+                sum += L(i, k) * L(j, k);
+            }
+
+            CHECK(sum == Approx(A(i, j)));
+        }
+    }
+}
+
+TEST_CASE("cholesky : solve single and multiple right-hand sides")
+{
+    auto const n = 40;
+
+    auto const A = make_positive_definite<grabin::symmetric_matrix<double>>(n);
+    auto L = A;
+    grabin::cholesky_factorize(L);
+
+    std::vector<grabin::math_vector<double>> bs;
+
+    for(auto r = 0; r < 21; ++ r)
+    {
+        bs.push_back(grabin_test::make_test_vector(n, r));
+    }
+
+    auto xs = bs;
+    grabin::cholesky_solve(L, xs.begin(), xs.end());
+
+    for(auto r = 0*bs.size(); r < bs.size(); ++ r)
+    {
+        auto x = bs[r];
+        grabin::cholesky_solve(L, x);
+
+        auto const Ax = A * x;
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            CHECK(Ax[i] == Approx(bs[r][i]));
+            CHECK(xs[r][i] == Approx(x[i]));
+        }
+    }
+
+    // Правая часть может быть представлением
+    std::vector<double> table(2 * n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        table[2 * i + 1] = bs[0][i];
+    }
+
+    grabin::cholesky_solve(L, grabin::make_strided_vector_view(table.data() + 1, n, 2));
+
+    auto x0 = bs[0];
+    grabin::cholesky_solve(L, x0);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(table[2 * i + 1] == x0[i]);
+    }
+
+    CHECK_THROWS_AS(grabin::cholesky_solve(L, grabin::math_vector<double>(3)), std::logic_error);
+}
+
+TEST_CASE("cholesky : Mahalanobis distance via forward substitution")
+{
+    auto const n = 12;
+
+    auto const A = make_positive_definite<grabin::symmetric_matrix<double>>(n);
+    auto L = A;
+    grabin::cholesky_factorize(L);
+
+    auto const x = grabin_test::make_test_vector(n, 0.5);
+
+    auto y = x;
+    grabin::cholesky_forward_substitution(L, y);
+
+    auto z = x;
+    grabin::cholesky_solve(L, z);
+
+    CHECK(grabin::dot(y, y) == Approx(grabin::dot(x, z)));
+
+    grabin::cholesky_back_substitution(L, y);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(y[i] == Approx(z[i]));
+    }
+}
+
+TEST_CASE("cholesky : matrix that is not positive definite")
+{
+    grabin::symmetric_matrix<double> A(3);
+    A(0, 0) = 1;
+    A(1, 0) = 2;
+    A(1, 1) = 1;
+    A(2, 2) = 1;
+
+    try
+    {
+        grabin::cholesky_factorize(A);
+        FAIL("factorization_error expected");
+    }
+    catch(grabin::factorization_error const & e)
+    {
+        CHECK(e.pivot() == 1);
+    }
+
+    grabin::symmetric_matrix<double> B(2);
+    B(0, 0) = std::nan("");
+    B(1, 1) = 1;
+
+    CHECK_THROWS_AS(grabin::cholesky_factorize(B), grabin::factorization_error);
+    grabin::symmetric_matrix<double> zero(2);
+    CHECK_THROWS_AS(grabin::cholesky_factorize(zero), std::runtime_error);
+}
+
+TEST_CASE("ldlt : factorization and solve")
+{
+    // Знаконеопределённая матрица
+    grabin::symmetric_matrix<double> A(2);
+    A(0, 0) = 1;
+    A(1, 0) = 2;
+    A(1, 1) = 1;
+
+    auto F = A;
+    grabin::ldlt_factorize(F);
+
+    CHECK(F(0, 0) == 1.0);
+    CHECK(F(1, 0) == 2.0);
+    CHECK(F(1, 1) == -3.0);
+
+    grabin::math_vector<double> b{5, 4};
+    grabin::ldlt_solve(F, b);
+
+    CHECK(b[0] == Approx(1.0));
+    CHECK(b[1] == Approx(2.0));
+
+    grabin::symmetric_matrix<double> Z(2);
+    Z(1, 0) = 1;
+
+    try
+    {
+        grabin::ldlt_factorize(Z);
+        FAIL("factorization_error expected");
+    }
+    catch(grabin::factorization_error const & e)
+    {
+        CHECK(e.pivot() == 0);
+    }
+}
+
+TEST_CASE("ldlt : agrees with cholesky on a large matrix")
+{
+    auto const n = 230;
+
+    auto const A = make_positive_definite<grabin::aligned_symmetric_matrix<double>>(n);
+
+    auto L = A;
+    grabin::cholesky_factorize(L);
+
+    auto F = A;
+    grabin::ldlt_factorize(F);
+
+    for(auto i = 0*n; i < n; i += 11)
+    {
+        auto const d = std::sqrt(F(i, i));
+
+        CHECK(L(i, i) == Approx(d));
+
+        for(auto j = 0*n; j < i; ++ j)
+        {
+            CHECK(L(i, j) == Approx(F(i, j) * std::sqrt(F(j, j))).margin(1e-12));
+        }
+    }
+
+    std::vector<grabin::math_vector<double>> xs{grabin_test::make_test_vector(n, 0), grabin_test::make_test_vector(n, 1)};
+    auto ys = xs;
+
+    grabin::ldlt_solve(F, xs.begin(), xs.end());
+    grabin::cholesky_solve(L, ys.begin(), ys.end());
+
+    for(auto r = 0*xs.size(); r < xs.size(); ++ r)
+    {
+        auto x = grabin_test::make_test_vector(n, double(r));
+        grabin::ldlt_solve(F, x);
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            CHECK(xs[r][i] == Approx(ys[r][i]));
+            CHECK(xs[r][i] == Approx(x[i]));
+        }
+    }
+}
@@ -332,3 +332,193 @@ TEST_CASE("math_vector : variance accumulation")
         CHECK_THAT(S2(i,j), Catch::Matchers::WithinAbs(x1[i]*x1[j], 1e-10));
     }
 }
+
+#include <grabin/linear_algebra/blas.hpp>
+#include <grabin/linear_algebra/outer_product.hpp>
+
+#include <memory>
+
+namespace
+{
+    struct test_arena
+    {
+        int allocations = 0;
+        int deallocations = 0;
+    };
+
+    template <class T>
+    class arena_allocator
+    {
+    public:
+        using value_type = T;
+
+        explicit arena_allocator(test_arena & arena)
+         : arena_(&arena)
+        {}
+
+        template <class U>
+        arena_allocator(arena_allocator<U> const & other)
+         : arena_(other.arena())
+        {}
+
+        T * allocate(std::size_t n)
+        {
+            ++ this->arena_->allocations;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T * p, std::size_t n)
+        {
+            ++ this->arena_->deallocations;
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        test_arena * arena() const
+        {
+            return this->arena_;
+        }
+
+        friend bool operator==(arena_allocator const & x, arena_allocator const & y)
+        {
+            return x.arena_ == y.arena_;
+        }
+
+        friend bool operator!=(arena_allocator const & x, arena_allocator const & y)
+        {
+            return !(x == y);
+        }
+
+    private:
+        test_arena * arena_;
+    };
+}
+
+TEST_CASE("math_vector : allocator")
+{
+    using Alloc = arena_allocator<double>;
+    using Vector = grabin::math_vector<double, grabin::vector_policy_throws, Alloc>;
+
+    test_arena arena;
+    Alloc const alloc(arena);
+
+    Vector x{{1.0, 2.0, 3.0}, alloc};
+    CHECK(x.get_allocator() == alloc);
+    CHECK(arena.allocations == 1);
+
+    Vector y(0, alloc);
+    y = 2.0 * x + x;
+    CHECK(y == (Vector{{3.0, 6.0, 9.0}, alloc}));
+    CHECK(y.get_allocator() == alloc);
+
+    auto const allocations = arena.allocations;
+    y += x;
+    y = x - y;
+    CHECK(arena.allocations == allocations);
+
+    test_arena other_arena;
+    Vector const z(x, Alloc(other_arena));
+    CHECK(z == x);
+    CHECK(z.get_allocator() == Alloc(other_arena));
+    CHECK(other_arena.allocations == 1);
+
+    Vector const w(x + z, alloc);
+    CHECK(w.get_allocator() == alloc);
+
+    auto const A = grabin::outer_square(x);
+    static_assert(std::is_same<decltype(A)::allocator_type, Alloc>::value, "");
+    CHECK(A.get_allocator() == alloc);
+    CHECK((A * 2.0).get_allocator() == alloc);
+    CHECK((A + A).get_allocator() == alloc);
+}
+
+TEST_CASE("math_vector : allocator is taken from vector expression")
+{
+    using Alloc = arena_allocator<double>;
+    using Vector = grabin::math_vector<double, grabin::vector_policy_throws, Alloc>;
+    using Matrix = grabin::symmetric_matrix<double, grabin::vector_policy_throws, Alloc>;
+
+    test_arena arena;
+    test_arena other_arena;
+    Alloc const alloc(arena);
+    Alloc const other_alloc(other_arena);
+
+    Vector const x{{1.0, 2.0}, alloc};
+    Vector const z{{3.0, -1.0}, other_alloc};
+
+    static_assert(std::is_same<decltype((2.0 * x + x).get_allocator()), Alloc>::value, "");
+
+    Vector const sum = 2.0 * x + x;
+    CHECK(sum == (Vector{{3.0, 6.0}, alloc}));
+    CHECK(sum.get_allocator() == alloc);
+
+    // Используется распределитель памяти первого аргумента
+    Vector const forward = x - z;
+    CHECK(forward.get_allocator() == alloc);
+
+    Vector const backward = z / 2.0 - x;
+    CHECK(backward.get_allocator() == other_alloc);
+
+    Matrix A(2, other_alloc);
+    A(0, 0) = 2.0;
+    A(1, 0) = 1.0;
+    A(1, 1) = 3.0;
+
+    auto const y = A * x;
+    static_assert(std::is_same<decltype(y), Vector const>::value, "");
+    CHECK(y.get_allocator() == other_alloc);
+    CHECK(y == (Vector{{4.0, 7.0}, alloc}));
+}
+
+TEST_CASE("symmetric_matrix : allocator")
+{
+    using Alloc = arena_allocator<double>;
+    using Vector = grabin::math_vector<double, grabin::vector_policy_throws, Alloc>;
+    using Matrix = grabin::symmetric_matrix<double, grabin::vector_policy_throws, Alloc>;
+
+    test_arena arena;
+    Alloc const alloc(arena);
+
+    std::vector<Vector> xs(10, Vector{{1.0, -2.0}, alloc});
+
+    Matrix A(2, alloc);
+    Vector const shift(2, alloc);
+
+    auto const allocations = arena.allocations;
+    auto const deallocations = arena.deallocations;
+
+    A.rank_k_update(1.0, xs.begin(), xs.end(), shift);
+    A.rank_one_update(1.0, xs.front());
+
+    CHECK(A(1, 0) == -22.0);
+
+    // Единственное выделение памяти --- буфер для блока векторов
+    CHECK(arena.allocations == allocations + 1);
+    CHECK(arena.deallocations == deallocations + 1);
+}
+
+TEST_CASE("math_vector : variance accumulation with allocator")
+{
+    using Alloc = arena_allocator<double>;
+    using Vector = grabin::math_vector<double, grabin::vector_policy_throws, Alloc>;
+
+    test_arena arena;
+    Alloc const alloc(arena);
+
+    auto acc = grabin::variance_accumulator<Vector>(Vector(2, alloc));
+
+    Vector x(2, alloc);
+    auto const allocations = arena.allocations;
+
+    for(auto n = 0; n < 100; ++ n)
+    {
+        x[0] = n;
+        x[1] = n % 7;
+        acc(x);
+    }
+
+    // Накопление не выделяет память
+    CHECK(arena.allocations == allocations);
+
+    CHECK(acc.mean().get_allocator() == alloc);
+    CHECK(acc.variance().get_allocator() == alloc);
+}
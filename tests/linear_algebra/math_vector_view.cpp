@@ -0,0 +1,425 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/math_vector_view.hpp>
+#include <grabin/linear_algebra/outer_product.hpp>
+#include <grabin/linear_algebra/static_math_vector.hpp>
+
+#include <catch/catch.hpp>
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("math_vector_view : view over raw buffer")
+{
+    double buffer[] = {1.0, 2.0, 3.0, 4.0, 5.0};
+
+    auto const v = grabin::make_math_vector_view(buffer + 1, 3);
+
+    REQUIRE(v.dim() == 3);
+    CHECK(v.data() == buffer + 1);
+
+    for(auto i = 0*v.dim(); i < v.dim(); ++ i)
+    {
+        CHECK(&v[i] == buffer + 1 + i);
+    }
+
+    v[0] = -2.0;
+    CHECK(buffer[1] == -2.0);
+
+    CHECK_THROWS_AS(v[-1], std::logic_error);
+    CHECK_THROWS_AS(v[v.dim()], std::logic_error);
+}
+
+TEST_CASE("math_vector_view : view over vectors")
+{
+    grabin::math_vector<double> x{1.0, 2.0, 3.0};
+    grabin::static_math_vector<double, 3> const y{4.0, 5.0, 6.0};
+
+    grabin::math_vector_view<double> vx(x);
+    grabin::math_vector_view<double const> vy(y);
+    grabin::math_vector_view<double const> cvx(vx);
+
+    CHECK(vx.data() == x.data());
+    CHECK(vy.data() == y.data());
+    CHECK(cvx.data() == x.data());
+    CHECK(vx.dim() == x.dim());
+
+    vx *= 2.0;
+    CHECK(x == (grabin::math_vector<double>{2.0, 4.0, 6.0}));
+
+    vx += vy;
+    CHECK(x == (grabin::math_vector<double>{6.0, 9.0, 12.0}));
+
+    vx -= vy * 2.0;
+    CHECK(x == (grabin::math_vector<double>{-2.0, -1.0, 0.0}));
+
+    vx /= -2.0;
+    CHECK(x == (grabin::math_vector<double>{1.0, 0.5, 0.0}));
+
+    CHECK_THROWS_AS(vx /= 0.0, std::logic_error);
+}
+
+TEST_CASE("math_vector_view : arithmetic")
+{
+    double const buffer[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    grabin::math_vector_view<double const> const x(buffer, 3);
+    grabin::math_vector_view<double const> const y(buffer + 3, 3);
+
+    grabin::math_vector<double> const z = 2.0 * x - y;
+
+    CHECK(z == (grabin::math_vector<double>{-2.0, -1.0, 0.0}));
+    CHECK(x == (grabin::math_vector<double>{1.0, 2.0, 3.0}));
+    CHECK(x != y);
+
+    CHECK_THROWS_AS(x + grabin::math_vector_view<double const>(buffer, 2), std::logic_error);
+}
+
+TEST_CASE("math_vector_view : adding contiguous and other vectors")
+{
+    // Длина больше ширины векторных регистров, чтобы проверить и векторную часть, и остаток
+    auto const n = 37;
+
+    std::vector<double> buffer(n);
+    grabin::math_vector<double> x(n);
+    std::vector<double> expected(n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        buffer[i] = std::sin(i);
+        x[i] = std::cos(i);
+        expected[i] = buffer[i];
+    }
+
+    grabin::math_vector_view<double> view(buffer.data(), n);
+    grabin::math_vector_view<double const> const x_view(x);
+
+    view += x;
+    view -= 2.0 * x;
+    view += x_view;
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        expected[i] += x[i];
+        expected[i] -= 2.0 * x[i];
+        expected[i] += x[i];
+    }
+
+    CHECK(buffer == expected);
+
+    CHECK_THROWS_AS(view += grabin::math_vector<double>(n - 1), std::logic_error);
+    CHECK_THROWS_AS(view -= grabin::math_vector<double>(n + 1), std::logic_error);
+}
+
+TEST_CASE("math_vector_view : outer_square")
+{
+    double const buffer[] = {3.0, -1.0, 4.0};
+
+    grabin::math_vector_view<double const> const x(buffer, 3);
+
+    auto const A = grabin::outer_square(x);
+
+    static_assert(std::is_same<decltype(A), grabin::symmetric_matrix<double> const>::value, "");
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    for(auto j = 0*x.dim(); j < x.dim(); ++ j)
+    {
+        CHECK(A(i, j) == x[i] * x[j]);
+    }
+}
+
+#include <grabin/statistics/variance.hpp>
+
+TEST_CASE("math_vector_view : accumulation of samples from row-major buffer")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const dim = 4;
+    auto const count = 100;
+
+    std::vector<double> buffer;
+    for(auto n = 0; n < count; ++ n)
+    for(auto i = 0; i < dim; ++ i)
+    {
+        buffer.push_back(std::sin(n * (i + 1)) + i);
+    }
+
+    auto mean_acc = grabin::mean_accumulator<Vector>(Vector(dim));
+    auto mean_acc_copy = grabin::mean_accumulator<Vector>(Vector(dim));
+    auto var_acc = grabin::variance_accumulator<Vector>(Vector(dim));
+    auto var_acc_copy = grabin::variance_accumulator<Vector>(Vector(dim));
+
+    for(auto n = 0; n < count; ++ n)
+    {
+        grabin::math_vector_view<double const> const x(buffer.data() + n * dim, dim);
+
+        mean_acc(x);
+        var_acc(x);
+
+        Vector const x_copy = x;
+        mean_acc_copy(x_copy);
+        var_acc_copy(x_copy);
+    }
+
+    REQUIRE(mean_acc.count() == count);
+    REQUIRE(var_acc.count() == count);
+
+    CHECK(mean_acc.mean() == mean_acc_copy.mean());
+    CHECK(var_acc.mean() == var_acc_copy.mean());
+
+    auto const V = var_acc.variance();
+    auto const V_copy = var_acc_copy.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    for(auto j = 0*dim; j < dim; ++ j)
+    {
+        CHECK(V(i, j) == V_copy(i, j));
+    }
+
+    CHECK_THROWS_AS(var_acc(grabin::math_vector_view<double const>(buffer.data(), dim - 1)),
+                    std::logic_error);
+}
+
+#include <algorithm>
+
+TEST_CASE("strided_vector_view : column of row-major matrix")
+{
+    // Матрица 3x4, хранящаяся по строкам
+    double buffer[] = { 1,  2,  3,  4,
+                        5,  6,  7,  8,
+                        9, 10, 11, 12};
+
+    auto column = grabin::make_strided_vector_view(buffer + 2, 3, 4);
+
+    REQUIRE(column.dim() == 3);
+    CHECK(column.stride() == 4);
+    CHECK(column == (grabin::math_vector<double>{3, 7, 11}));
+
+    CHECK_THROWS_AS(column[-1], std::logic_error);
+    CHECK_THROWS_AS(column[3], std::logic_error);
+
+    column *= 2.0;
+    CHECK(buffer[2] == 6);
+    CHECK(buffer[6] == 14);
+    CHECK(buffer[10] == 22);
+
+    column /= 2.0;
+    column += grabin::math_vector<double>{1, 1, 1};
+    column -= grabin::make_strided_vector_view(buffer, 3, 4);
+    CHECK(column == (grabin::math_vector<double>{3, 3, 3}));
+    CHECK(buffer[3] == 4);
+}
+
+TEST_CASE("strided_vector_view : view over vector")
+{
+    grabin::math_vector<int> x{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    grabin::strided_vector_view<int const> const even(x, 0, 5, 2);
+    grabin::strided_vector_view<int const> const reversed(x, 9, 10, -1);
+    grabin::strided_vector_view<int const> const slice(x, 3, 4);
+
+    CHECK(even == (grabin::math_vector<int>{0, 2, 4, 6, 8}));
+    CHECK(slice == (grabin::math_vector<int>{3, 4, 5, 6}));
+    CHECK(std::equal(reversed.begin(), reversed.end(), x.data(), x.data() + 10,
+                     [](int a, int b) { return a == 9 - b; }));
+
+    grabin::math_vector<int> const sum = even + 2 * slice.begin()[0] * even;
+    CHECK(sum == (grabin::math_vector<int>{0, 14, 28, 42, 56}));
+
+    CHECK_THROWS_AS(grabin::strided_vector_view<int>(x, 0, 6, 2), std::logic_error);
+    CHECK_THROWS_AS(grabin::strided_vector_view<int>(x, 10, 1), std::logic_error);
+    CHECK_THROWS_AS(grabin::strided_vector_view<int>(x, 2, 4, -1), std::logic_error);
+}
+
+TEST_CASE("vector_view_iterator : random access")
+{
+    int buffer[] = {5, 0, 3, 0, 1, 0, 4, 0, 2};
+
+    auto const x = grabin::make_strided_vector_view(buffer, 5, 2);
+
+    static_assert(std::is_same<std::iterator_traits<decltype(x.begin())>::iterator_category,
+                               std::random_access_iterator_tag>::value, "");
+
+    CHECK(x.end() - x.begin() == 5);
+    CHECK(x.begin()[3] == 4);
+    CHECK(*(x.begin() + 2) == 1);
+    CHECK(*(2 + x.begin()) == 1);
+    CHECK(*(x.end() - 1) == 2);
+    CHECK(x.begin() < x.end());
+    CHECK(x.end() >= x.begin());
+
+    std::sort(x.begin(), x.end());
+
+    CHECK(x == (grabin::math_vector<int>{1, 2, 3, 4, 5}));
+    CHECK(buffer[1] == 0);
+}
+
+TEST_CASE("indexed_vector_view : gather columns")
+{
+    grabin::math_vector<double> x{0, 10, 20, 30, 40, 50};
+    std::vector<std::ptrdiff_t> const columns{4, 1, 5};
+
+    grabin::indexed_vector_view<double> v(x, columns);
+
+    REQUIRE(v.dim() == 3);
+    CHECK(v == (grabin::math_vector<double>{40, 10, 50}));
+
+    CHECK_THROWS_AS(v[3], std::logic_error);
+
+    v += grabin::math_vector<double>{1, 2, 3};
+    CHECK(x == (grabin::math_vector<double>{0, 12, 20, 30, 41, 53}));
+
+    v *= 2.0;
+    v /= 2.0;
+    v -= grabin::math_vector<double>{1, 2, 3};
+    CHECK(x == (grabin::math_vector<double>{0, 10, 20, 30, 40, 50}));
+
+    std::vector<std::ptrdiff_t> const bad_columns{1, 6};
+    CHECK_THROWS_AS((grabin::indexed_vector_view<double>(x, bad_columns)), std::logic_error);
+}
+
+TEST_CASE("indexed_vector_view : temporary indices are rejected")
+{
+    using Vector = grabin::math_vector<double>;
+    using Indices = std::vector<std::ptrdiff_t>;
+    using View = grabin::indexed_vector_view<double>;
+
+    static_assert(std::is_constructible<View, Vector &, Indices &>::value, "");
+    static_assert(std::is_constructible<View, Vector &, Indices const &>::value, "");
+    static_assert(!std::is_constructible<View, Vector &, Indices>::value, "");
+    static_assert(!std::is_constructible<View, Vector &, Indices &&>::value, "");
+
+    Vector x{0, 10, 20};
+    Indices columns{2, 0};
+
+    auto v = grabin::make_indexed_vector_view(x, columns);
+    static_assert(std::is_same<decltype(v), View>::value, "");
+
+    CHECK(v == (Vector{20, 0}));
+
+    Vector const & cx = x;
+    auto cv = grabin::make_indexed_vector_view(cx, columns);
+    static_assert(std::is_same<decltype(cv), grabin::indexed_vector_view<double const>>::value, "");
+
+    CHECK(cv == (Vector{20, 0}));
+}
+
+TEST_CASE("views : compound assignment is shared by all kinds of views")
+{
+    std::vector<double> a{1.0, 2.0, 3.0};
+    std::vector<double> b{1.0, 0.0, 2.0, 0.0, 3.0, 0.0};
+    std::vector<double> c{4.0, 5.0, 6.0, 7.0};
+    std::vector<std::ptrdiff_t> const indices{3, 1, 0};
+
+    auto contiguous = grabin::make_math_vector_view(a.data(), 3);
+    auto strided = grabin::make_strided_vector_view(b.data(), 3, 2);
+    auto indexed = grabin::make_indexed_vector_view(c.data(), indices.data(), 3);
+
+    static_assert(std::is_same<decltype(contiguous *= 2.0), decltype(contiguous) &>::value, "");
+    static_assert(std::is_same<decltype(strided += contiguous), decltype(strided) &>::value, "");
+    static_assert(std::is_same<decltype(indexed /= 2.0), decltype(indexed) &>::value, "");
+
+    contiguous *= 2.0;
+    CHECK(a == (std::vector<double>{2.0, 4.0, 6.0}));
+
+    strided -= contiguous;
+    CHECK(b == (std::vector<double>{-1.0, 0.0, -2.0, 0.0, -3.0, 0.0}));
+
+    indexed += strided;
+    CHECK(c == (std::vector<double>{1.0, 3.0, 6.0, 6.0}));
+
+    indexed /= 2.0;
+    strided *= 3.0;
+    contiguous /= 2.0;
+    CHECK(a == (std::vector<double>{1.0, 2.0, 3.0}));
+    CHECK(b == (std::vector<double>{-3.0, 0.0, -6.0, 0.0, -9.0, 0.0}));
+    CHECK(c == (std::vector<double>{0.5, 1.5, 6.0, 3.0}));
+
+    CHECK(std::vector<double>(strided.begin(), strided.end())
+          == (std::vector<double>{-3.0, -6.0, -9.0}));
+    CHECK(std::vector<double>(indexed.begin(), indexed.end())
+          == (std::vector<double>{3.0, 1.5, 0.5}));
+    CHECK(std::vector<double>(contiguous.begin(), contiguous.end()) == a);
+}
+
+TEST_CASE("strided and indexed views : accumulation of selected columns")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const width = 13;
+    auto const count = 200;
+
+    std::vector<double> records;
+    for(auto n = 0; n < count; ++ n)
+    for(auto i = 0; i < width; ++ i)
+    {
+        records.push_back(std::cos(n * (i + 1)) * (i + 1));
+    }
+
+    // Столбцы 3, 7, 9..12
+    std::vector<std::ptrdiff_t> const columns{3, 7, 9, 10, 11, 12};
+    auto const dim = static_cast<std::ptrdiff_t>(columns.size());
+
+    auto acc = grabin::variance_accumulator<Vector>(Vector(dim));
+    auto acc_strided = grabin::variance_accumulator<Vector>(Vector(4));
+    auto acc_copy = grabin::variance_accumulator<Vector>(Vector(dim));
+    auto acc_strided_copy = grabin::variance_accumulator<Vector>(Vector(4));
+
+    for(auto n = 0; n < count; ++ n)
+    {
+        auto const record = records.data() + n * width;
+
+        auto const x = grabin::make_indexed_vector_view(record, columns.data(), dim);
+        acc(x);
+
+        Vector x_copy(dim);
+        for(auto i = 0*dim; i < dim; ++ i)
+        {
+            x_copy[i] = record[columns[i]];
+        }
+        acc_copy(x_copy);
+
+        // Столбцы 9..12
+        auto const y = grabin::make_strided_vector_view(record + 9, 4, 1);
+        acc_strided(y);
+        acc_strided_copy(Vector{record[9], record[10], record[11], record[12]});
+    }
+
+    CHECK(acc.mean() == acc_copy.mean());
+    CHECK(acc_strided.mean() == acc_strided_copy.mean());
+
+    auto const V = acc.variance();
+    auto const V_copy = acc_copy.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    for(auto j = 0*dim; j < dim; ++ j)
+    {
+        CHECK(V(i, j) == V_copy(i, j));
+    }
+
+    auto const W = acc_strided.variance();
+    auto const W_copy = acc_strided_copy.variance();
+
+    for(auto i = 0; i < 4; ++ i)
+    for(auto j = 0; j < 4; ++ j)
+    {
+        CHECK(W(i, j) == W_copy(i, j));
+    }
+
+    auto const A = grabin::outer_square(grabin::make_strided_vector_view(records.data(), 3, width));
+    CHECK(A(2, 1) == records[2 * width] * records[width]);
+}
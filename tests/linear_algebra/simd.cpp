@@ -0,0 +1,248 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/simd.hpp>
+#include <grabin/linear_algebra/math_vector.hpp>
+
+#include <catch/catch.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    std::vector<grabin::simd::instruction_set> supported_instruction_sets()
+    {
+        using grabin::simd::instruction_set;
+
+        std::vector<instruction_set> result;
+
+        for(auto isa : {instruction_set::generic, instruction_set::sse2,
+                        instruction_set::avx2, instruction_set::avx512})
+        {
+            if(isa <= grabin::simd::supported_instruction_set())
+            {
+                result.push_back(isa);
+            }
+        }
+
+        return result;
+    }
+
+    template <class T>
+    std::vector<T> make_test_data(std::size_t n, T shift)
+    {
+        std::vector<T> result(n);
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            result[i] = T(i % 7) / T(3) - T(i % 5) * shift;
+        }
+
+        return result;
+    }
+
+    template <class T>
+    void check_simd_kernels()
+    {
+        T const a = T(1) / T(7);
+
+        // Длины выбраны так, чтобы проверить как векторную часть, так и остаток
+        for(auto n : {0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100})
+        {
+            auto const x = make_test_data<T>(n, T(0.25));
+            auto const y = make_test_data<T>(n, T(-1.5));
+
+            auto expected_sum = y;
+            auto expected_diff = y;
+            auto expected_prod = y;
+            auto expected_quot = y;
+
+            for(auto i = 0*n; i < n; ++ i)
+            {
+                expected_sum[i] += x[i];
+                expected_diff[i] -= x[i];
+                expected_prod[i] *= a;
+                expected_quot[i] /= a;
+            }
+
+            for(auto isa : supported_instruction_sets())
+            {
+                CAPTURE(n);
+                CAPTURE(static_cast<int>(isa));
+
+                auto sum = y;
+                grabin::simd::add(sum.data(), x.data(), sum.size(), isa);
+                CHECK(sum == expected_sum);
+
+                auto diff = y;
+                grabin::simd::subtract(diff.data(), x.data(), diff.size(), isa);
+                CHECK(diff == expected_diff);
+
+                auto prod = y;
+                grabin::simd::multiply(prod.data(), a, prod.size(), isa);
+                CHECK(prod == expected_prod);
+
+                auto quot = y;
+                grabin::simd::divide(quot.data(), a, quot.size(), isa);
+                CHECK(quot == expected_quot);
+            }
+
+            // Четыре прибавления за один проход дают тот же результат, что и четыре axpy
+            T const as[4] = {a, T(-2) * a, T(3), T(1) / T(11)};
+            std::vector<T> const xs[4] = {x, y, make_test_data<T>(n, T(2)),
+                                          make_test_data<T>(n, T(-0.125))};
+            T const * const x_ptrs[4] = {xs[0].data(), xs[1].data(), xs[2].data(), xs[3].data()};
+
+            auto expected_axpy4 = y;
+
+            for(auto r = 0; r < 4; ++ r)
+            {
+                for(auto i = 0*n; i < n; ++ i)
+                {
+                    expected_axpy4[i] += as[r] * xs[r][i];
+                }
+            }
+
+            for(auto isa : supported_instruction_sets())
+            {
+                CAPTURE(n);
+                CAPTURE(static_cast<int>(isa));
+
+                auto z = y;
+                grabin::simd::axpy4(z.data(), as, x_ptrs, z.size(), isa);
+                CHECK(z == expected_axpy4);
+            }
+        }
+    }
+
+    template <class T>
+    void check_simd_reductions()
+    {
+        auto const lanes = grabin::simd::reduction_lanes<T>::value;
+        T const a = T(1) / T(3);
+
+        for(auto n : {0, 1, 3, 7, 16, 31, 32, 33, 64, 100, 257})
+        {
+            auto const x = make_test_data<T>(n, T(0.25));
+            auto const y = make_test_data<T>(n, T(-1.5));
+
+            // Эталонный порядок: слагаемое i в частичную сумму i % lanes, затем попарно
+            std::vector<T> dot_lanes(lanes, T(0));
+            std::vector<T> abs_lanes(lanes, T(0));
+            auto expected_axpy = y;
+
+            for(auto i = 0*n; i < n; ++ i)
+            {
+                dot_lanes[i % lanes] += x[i] * y[i];
+                abs_lanes[i % lanes] += std::abs(y[i]);
+                expected_axpy[i] += a * x[i];
+            }
+
+            for(auto h = lanes / 2; h > 0; h /= 2)
+            {
+                for(auto k = 0*h; k < h; ++ k)
+                {
+                    dot_lanes[k] += dot_lanes[k + h];
+                    abs_lanes[k] += abs_lanes[k + h];
+                }
+            }
+
+            for(auto isa : supported_instruction_sets())
+            {
+                CAPTURE(n);
+                CAPTURE(static_cast<int>(isa));
+
+                CHECK(grabin::simd::dot(x.data(), y.data(), x.size(), isa) == dot_lanes[0]);
+                CHECK(grabin::simd::sum_abs(y.data(), y.size(), isa) == abs_lanes[0]);
+
+                auto z = y;
+                grabin::simd::axpy(z.data(), a, x.data(), z.size(), isa);
+                CHECK(z == expected_axpy);
+            }
+        }
+    }
+}
+
+TEST_CASE("simd : reductions do not depend on instruction set")
+{
+    check_simd_reductions<double>();
+    check_simd_reductions<float>();
+
+    std::vector<int> const x{1, -2, 3, -4, 5};
+    CHECK(grabin::simd::dot(x.data(), x.data(), x.size()) == 55);
+    CHECK(grabin::simd::sum_abs(x.data(), x.size()) == 15);
+}
+
+TEST_CASE("simd : double kernels match scalar loops exactly")
+{
+    check_simd_kernels<double>();
+}
+
+TEST_CASE("simd : float kernels match scalar loops exactly")
+{
+    check_simd_kernels<float>();
+}
+
+TEST_CASE("simd : generic kernels for other types")
+{
+    std::vector<int> y{1, 2, 3, 4, 5};
+    std::vector<int> const x{5, 4, 3, 2, 1};
+
+    grabin::simd::add(y.data(), x.data(), y.size());
+    CHECK(y == (std::vector<int>{6, 6, 6, 6, 6}));
+
+    grabin::simd::multiply(y.data(), 2, y.size());
+    CHECK(y == (std::vector<int>{12, 12, 12, 12, 12}));
+
+    grabin::simd::subtract(y.data(), x.data(), y.size());
+    CHECK(y == (std::vector<int>{7, 8, 9, 10, 11}));
+
+    grabin::simd::divide(y.data(), 3, y.size());
+    CHECK(y == (std::vector<int>{2, 2, 3, 3, 3}));
+}
+
+TEST_CASE("simd : math_vector compound assignment")
+{
+    grabin::math_vector<double> x(19);
+    grabin::math_vector<double> y(19);
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        x[i] = 0.5 * i;
+        y[i] = 3.0 - i;
+    }
+
+    auto z = y;
+    z += x;
+    z *= 4.0;
+    z -= y;
+    z /= 2.0;
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        CHECK(z[i] == ((y[i] + x[i]) * 4.0 - y[i]) / 2.0);
+    }
+
+    z += z;
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        CHECK(z[i] == ((y[i] + x[i]) * 4.0 - y[i]));
+    }
+
+    CHECK_THROWS_AS(z += grabin::math_vector<double>(3), std::logic_error);
+    CHECK_THROWS_AS(z /= 0.0, std::logic_error);
+}
@@ -0,0 +1,200 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/static_math_vector.hpp>
+
+#include <grabin/linear_algebra/math_vector.hpp>
+#include <grabin/statistics/variance.hpp>
+
+#include <catch/catch.hpp>
+
+#include <cmath>
+#include <type_traits>
+
+namespace
+{
+    using Vector3i = grabin::static_math_vector<int, 3>;
+
+    constexpr Vector3i make_constexpr_combination()
+    {
+        Vector3i x{1, 2, 3};
+        Vector3i const y{4, 5, 6};
+
+        x += y;
+        x *= 2;
+        x -= Vector3i(1);
+
+        return x;
+    }
+}
+
+TEST_CASE("static_math_vector : constexpr arithmetic")
+{
+    constexpr Vector3i x{1, 2, 3};
+    constexpr Vector3i y{-1, 0, 5};
+
+    static_assert(x.dim() == 3, "");
+    static_assert((x + y) == Vector3i{0, 2, 8}, "");
+    static_assert((x - y) == Vector3i{2, 2, -2}, "");
+    static_assert(x * 2 == Vector3i{2, 4, 6}, "");
+    static_assert(3 * x == Vector3i{3, 6, 9}, "");
+    static_assert((x * 4) / 2 == Vector3i{2, 4, 6}, "");
+    static_assert(x != y, "");
+    static_assert(make_constexpr_combination() == Vector3i{9, 13, 17}, "");
+    static_assert(Vector3i() == Vector3i(0), "");
+
+    CHECK(make_constexpr_combination() == (Vector3i{9, 13, 17}));
+}
+
+TEST_CASE("static_math_vector : storage is inline")
+{
+    static_assert(sizeof(grabin::static_math_vector<double, 4>) == 4 * sizeof(double), "");
+    static_assert(std::is_trivially_copyable<grabin::static_math_vector<double, 4>>::value, "");
+    static_assert(std::is_trivially_destructible<grabin::static_math_vector<double, 4>>::value, "");
+}
+
+TEST_CASE("static_math_vector : ctor")
+{
+    grabin::static_math_vector<double, 4> const zero;
+    grabin::static_math_vector<double, 4> const filled(2.5);
+
+    for(auto i = 0*zero.dim(); i < zero.dim(); ++ i)
+    {
+        CHECK(zero[i] == 0.0);
+        CHECK(filled[i] == 2.5);
+    }
+
+    CHECK_THROWS_AS((grabin::static_math_vector<double, 4>{1.0, 2.0}), std::logic_error);
+}
+
+TEST_CASE("static_math_vector : throws if index is out of range")
+{
+    Vector3i x{1, 2, 3};
+    Vector3i const & cx = x;
+
+    CHECK_THROWS_AS(x[-1], std::logic_error);
+    CHECK_THROWS_AS(x[x.dim()], std::logic_error);
+    CHECK_THROWS_AS(cx[-1], std::logic_error);
+    CHECK_THROWS_AS(cx[x.dim()], std::logic_error);
+
+    x[1] = 42;
+    CHECK(cx[1] == 42);
+}
+
+TEST_CASE("static_math_vector : division by zero")
+{
+    grabin::static_math_vector<double, 2> x{1.0, 2.0};
+
+    CHECK_THROWS_AS(x /= 0.0, std::logic_error);
+    CHECK_THROWS_AS(x / 0, std::logic_error);
+}
+
+TEST_CASE("static_math_vector : mixes with math_vector and vector expressions")
+{
+    using Static_vector = grabin::static_math_vector<double, 3>;
+    using Vector = grabin::math_vector<double>;
+
+    static_assert(grabin::is_vector_expression<Static_vector>::value, "");
+
+    Static_vector s{1.0, 2.0, 3.0};
+    Vector m{10.0, 20.0, 30.0};
+
+    m += s;
+    CHECK(m == (Vector{11.0, 22.0, 33.0}));
+
+    m -= s;
+    CHECK(m == (Vector{10.0, 20.0, 30.0}));
+
+    Vector const sum = m + s;
+    CHECK(sum == (Vector{11.0, 22.0, 33.0}));
+
+    Vector const diff = s - m;
+    CHECK(diff == (Vector{-9.0, -18.0, -27.0}));
+
+    s += m - sum;
+    CHECK(s == (Static_vector{0.0, 0.0, 0.0}));
+
+    s -= 2.0 * m;
+    CHECK(s == (Static_vector{-20.0, -40.0, -60.0}));
+
+    // Операции над двумя векторами фиксированной размерности по-прежнему возвращают вектор
+    static_assert(std::is_same<decltype(s + s), Static_vector>::value, "");
+    static_assert(std::is_same<decltype(s - s), Static_vector>::value, "");
+    static_assert(std::is_same<decltype(s * 2.0), Static_vector>::value, "");
+
+    Vector wide(4);
+    CHECK_THROWS_AS(wide += s, std::logic_error);
+    CHECK_THROWS_AS(s += wide, std::logic_error);
+}
+
+TEST_CASE("static_math_vector : variance accumulation matches math_vector")
+{
+    using Static_vector = grabin::static_math_vector<double, 3>;
+    using Vector = grabin::math_vector<double>;
+
+    static_assert(std::is_same<grabin::variance_accumulator<Static_vector>::variance_type,
+                               grabin::static_symmetric_matrix<double, 3>>::value, "");
+
+    grabin::variance_accumulator<Static_vector> acc;
+    auto acc_dynamic = grabin::variance_accumulator<Vector>(Vector(3));
+
+    std::vector<Static_vector> xs;
+
+    for(auto n = 0; n < 200; ++ n)
+    {
+        Static_vector const x{std::sin(n) + 10, std::cos(3*n) * 2, std::sin(n) * std::cos(n)};
+
+        acc(x);
+        acc_dynamic(Vector{x[0], x[1], x[2]});
+        xs.push_back(x);
+    }
+
+    REQUIRE(acc.count() == acc_dynamic.count());
+
+    auto const V = acc.variance();
+    auto const V_dynamic = acc_dynamic.variance();
+
+    for(auto i = 0*V.dim(); i < V.dim(); ++ i)
+    {
+        CHECK(acc.mean()[i] == acc_dynamic.mean()[i]);
+
+        for(auto j = 0*V.dim(); j < V.dim(); ++ j)
+        {
+            CHECK(V(i, j) == V_dynamic(i, j));
+        }
+    }
+
+    grabin::variance_accumulator<Static_vector> acc_block;
+    acc_block.update_block(xs.begin(), xs.begin() + 50);
+
+    grabin::variance_accumulator<Static_vector> acc_rest;
+    acc_rest.update_block(xs.begin() + 50, xs.end());
+
+    acc_block.merge(acc_rest);
+
+    auto const V_block = acc_block.variance();
+
+    REQUIRE(acc_block.count() == acc.count());
+
+    for(auto i = 0*V.dim(); i < V.dim(); ++ i)
+    {
+        CHECK_THAT(acc_block.mean()[i], Catch::Matchers::WithinAbs(acc.mean()[i], 1e-12));
+
+        for(auto j = 0*V.dim(); j < V.dim(); ++ j)
+        {
+            CHECK_THAT(V_block(i, j), Catch::Matchers::WithinAbs(V(i, j), 1e-12));
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/outer_product.hpp>
+#include <grabin/linear_algebra/static_symmetric_matrix.hpp>
+
+#include <catch/catch.hpp>
+
+#include <vector>
+
+namespace
+{
+    using Vector = grabin::static_math_vector<int, 3>;
+    using Matrix = grabin::static_symmetric_matrix<int, 3>;
+
+    constexpr Matrix make_constexpr_matrix()
+    {
+        Matrix A;
+        A.rank_one_update(2, Vector{1, 2, 3});
+        A += grabin::outer_square(Vector{1, 0, -1});
+        return A;
+    }
+}
+
+TEST_CASE("static_symmetric_matrix : constexpr operations")
+{
+    constexpr auto A = make_constexpr_matrix();
+
+    static_assert(A.dim() == 3, "");
+    static_assert(A(0, 0) == 3, "");
+    static_assert(A(1, 0) == 4 && A(0, 1) == 4, "");
+    static_assert(A(2, 0) == 5 && A(0, 2) == 5, "");
+    static_assert(A(2, 2) == 19, "");
+    static_assert((A * 2)(2, 1) == 24, "");
+    static_assert((2 * A)(2, 1) == 24, "");
+    static_assert((A / 2)(2, 2) == 9, "");
+
+    static_assert(sizeof(Matrix) == 6 * sizeof(int), "");
+}
+
+TEST_CASE("static_symmetric_matrix : zero and filled matrix")
+{
+    Matrix const zero;
+    Matrix const filled(7);
+
+    for(auto i = 0*zero.dim(); i < zero.dim(); ++ i)
+    for(auto j = 0*zero.dim(); j < zero.dim(); ++ j)
+    {
+        CHECK(zero(i, j) == 0);
+        CHECK(filled(i, j) == 7);
+    }
+}
+
+TEST_CASE("static_symmetric_matrix : outer_square")
+{
+    Vector const x{3, -1, 4};
+
+    auto const A = grabin::outer_square(x);
+
+    static_assert(std::is_same<decltype(grabin::outer_square(x)), Matrix>::value, "");
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    for(auto j = 0*x.dim(); j < x.dim(); ++ j)
+    {
+        CHECK(A(i, j) == x[i] * x[j]);
+    }
+}
+
+TEST_CASE("static_symmetric_matrix : mutable access is symmetric")
+{
+    Matrix A;
+    A(0, 2) = 5;
+
+    CHECK(A(2, 0) == 5);
+    CHECK(A(0, 2) == 5);
+}
+
+TEST_CASE("static_symmetric_matrix : rank updates")
+{
+    Vector const x{1, 2, -1};
+    Vector const y{0, 3, 5};
+
+    Matrix A(1);
+    A.rank_two_update(3, x, y);
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    for(auto j = 0*x.dim(); j < x.dim(); ++ j)
+    {
+        CHECK(A(i, j) == 1 + 3 * (x[i] * y[j] + y[i] * x[j]));
+    }
+
+    std::vector<Vector> const xs{x, y, Vector{2, 2, 2}};
+    Vector const shift{1, 1, 1};
+
+    Matrix B;
+    B.rank_k_update(2, xs.begin(), xs.end(), shift);
+
+    Matrix B_expected;
+    for(auto const & z : xs)
+    {
+        B_expected += 2 * grabin::outer_square(z - shift);
+    }
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    for(auto j = 0*x.dim(); j < x.dim(); ++ j)
+    {
+        CHECK(B(i, j) == B_expected(i, j));
+    }
+}
@@ -13,11 +13,15 @@
    обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
 */
 
+#include <grabin/linear_algebra/math_vector_view.hpp>
 #include <grabin/linear_algebra/outer_product.hpp>
 #include <grabin/linear_algebra/symmetric_matrix.hpp>
 
 #include <catch/catch.hpp>
 
+#include <cmath>
+#include <vector>
+
 TEST_CASE("symmetric_matrix : zero matrix")
 {
     auto const n = 5;
@@ -190,3 +194,377 @@ TEST_CASE("symmetric_matrix : divide by scalar")
         CHECK(D(i, j) == C(i, j)/alpha);
     }
 }
+
+TEST_CASE("symmetric_matrix : rank one update")
+{
+    grabin::math_vector<int> const x{2, -3, 4};
+    grabin::math_vector<int> const y{1, 5, -2};
+    auto const alpha = 3;
+
+    auto C = grabin::outer_square(y);
+    auto const C_old = C;
+
+    auto & r = C.rank_one_update(alpha, x);
+
+    REQUIRE(&r == &C);
+    REQUIRE(C.dim() == x.dim());
+    auto const n = C.dim();
+
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j < n; ++ j)
+    {
+        CHECK(C(i, j) == C_old(i, j) + alpha*x[i]*x[j]);
+    }
+}
+
+TEST_CASE("symmetric_matrix : rank two update")
+{
+    grabin::math_vector<int> const x{2, -3, 4, 1};
+    grabin::math_vector<int> const y{1, 5, -2, 7};
+    auto const alpha = -2;
+
+    auto C = grabin::outer_square(x);
+    auto const C_old = C;
+
+    auto & r = C.rank_two_update(alpha, x, y);
+
+    REQUIRE(&r == &C);
+    REQUIRE(C.dim() == x.dim());
+    auto const n = C.dim();
+
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j < n; ++ j)
+    {
+        CHECK(C(i, j) == C_old(i, j) + alpha*(x[i]*y[j] + y[i]*x[j]));
+    }
+}
+
+TEST_CASE("symmetric_matrix : rank updates of contiguous vectors and views agree")
+{
+    auto const n = 37;
+
+    grabin::math_vector<double> x(n);
+    grabin::math_vector<double> y(n);
+    std::vector<double> table(2 * n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        x[i] = table[2 * i] = std::sin(0.3 * i + 1.0);
+        y[i] = table[2 * i + 1] = std::cos(1.7 * i);
+    }
+
+    // Непрерывные векторы обновляют строки с помощью simd::axpy, представления --- циклом
+    auto const x_view = grabin::make_strided_vector_view(table.data(), n, 2);
+    auto const y_view = grabin::make_strided_vector_view(table.data() + 1, n, 2);
+
+    grabin::symmetric_matrix<double> A(n);
+    grabin::symmetric_matrix<double> B(n);
+
+    A.rank_one_update(0.75, x);
+    B.rank_one_update(0.75, x_view);
+
+    A.rank_two_update(-1.25, x, y);
+    B.rank_two_update(-1.25, x_view, y_view);
+
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j <= i; ++ j)
+    {
+        auto const expected = 0.75 * x[i] * x[j] - 1.25 * (x[i] * y[j] + y[i] * x[j]);
+
+        CHECK(A(i, j) == Approx(expected));
+        CHECK(A(i, j) == Approx(B(i, j)));
+    }
+}
+
+TEST_CASE("symmetric_matrix : rank updates throw on different dimensions")
+{
+    grabin::math_vector<int> const x{2, -3, 4};
+    grabin::math_vector<int> const y{1, 5};
+
+    grabin::symmetric_matrix<int> C(x.dim());
+
+    CHECK_THROWS_AS(C.rank_one_update(1, y), std::logic_error);
+    CHECK_THROWS_AS(C.rank_two_update(1, x, y), std::logic_error);
+}
+
+TEST_CASE("symmetric_matrix : rank k update")
+{
+    using Vector = grabin::math_vector<int>;
+
+    auto const n = 100;
+    auto const k = 300;
+
+    // Блок больше 256 векторов и полосы строк в несколько тысяч элементов
+    std::vector<Vector> xs;
+    for(auto r = 0; r < k; ++ r)
+    {
+        Vector x(n);
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            x[i] = (r * 7 + i * 13) % 11 - 5;
+        }
+        xs.push_back(x);
+    }
+
+    Vector shift(n);
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        shift[i] = i % 3 - 1;
+    }
+
+    auto const alpha = 2;
+
+    grabin::symmetric_matrix<int> C(n);
+    auto & r = C.rank_k_update(alpha, xs.begin(), xs.end(), shift);
+
+    REQUIRE(&r == &C);
+
+    grabin::symmetric_matrix<int> C_expected(n);
+    for(auto const & x : xs)
+    {
+        C_expected.rank_one_update(alpha, x - shift);
+    }
+
+    CHECK(std::equal(C.begin(), C.end(), C_expected.begin(), C_expected.end()));
+}
+
+TEST_CASE("symmetric_matrix : rank k update of doubles matches rank one updates")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const n = 70;
+
+    // Семь векторов: одна четвёрка и остаток из трёх векторов
+    std::vector<Vector> xs;
+    for(auto r = 0; r < 7; ++ r)
+    {
+        Vector x(n);
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            x[i] = std::sin(0.3 * r + 0.7 * i);
+        }
+        xs.push_back(x);
+    }
+
+    Vector shift(n);
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        shift[i] = 0.25;
+    }
+
+    auto const alpha = 0.5;
+
+    grabin::symmetric_matrix<double> C(n);
+    C.rank_k_update(alpha, xs.begin(), xs.end(), shift);
+
+    grabin::symmetric_matrix<double> C_expected(n);
+    for(auto const & x : xs)
+    {
+        Vector const dx = x - shift;
+        C_expected.rank_one_update(alpha, dx);
+    }
+
+    CHECK(std::equal(C.begin(), C.end(), C_expected.begin(), C_expected.end()));
+}
+
+TEST_CASE("symmetric_matrix : rank k update throws on different dimensions")
+{
+    std::vector<grabin::math_vector<int>> const xs{{1, 2, 3}, {1, 2}};
+
+    grabin::symmetric_matrix<int> C(3);
+
+    CHECK_THROWS_AS(C.rank_k_update(1, xs.begin(), xs.end(), grabin::math_vector<int>(3)),
+                    std::logic_error);
+    CHECK_THROWS_AS(C.rank_k_update(1, xs.begin(), xs.begin(), grabin::math_vector<int>(2)),
+                    std::logic_error);
+}
+
+#include <cstdint>
+
+TEST_CASE("symmetric_matrix : padded rows layout offsets")
+{
+    using Layout = grabin::padded_rows_layout<64>;
+
+    // Для double в кэш-линию помещается 8 элементов
+    for(auto row = 0; row < 40; ++ row)
+    {
+        auto expected = 0;
+        for(auto r = 0; r < row; ++ r)
+        {
+            expected += (r + 1 + 7) / 8 * 8;
+        }
+
+        CHECK(Layout::row_offset<double>(row) == expected);
+    }
+
+    static_assert(Layout::row_offset<double>(1) == 8, "");
+    static_assert(grabin::packed_rows_layout::row_offset<double>(4) == 10, "");
+}
+
+TEST_CASE("symmetric_matrix : aligned storage with padded rows")
+{
+    using Matrix = grabin::aligned_symmetric_matrix<double>;
+    using Packed = grabin::symmetric_matrix<double>;
+
+    static_assert(std::is_same<Matrix::layout_type, grabin::padded_rows_layout<64>>::value, "");
+
+    auto const n = 19;
+
+    grabin::aligned_math_vector<double> x(n);
+    grabin::aligned_math_vector<double> y(n);
+    grabin::math_vector<double> px(n);
+    grabin::math_vector<double> py(n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        x[i] = px[i] = std::sin(i + 1.0);
+        y[i] = py[i] = std::cos(3.0 * i);
+    }
+
+    Matrix A(n);
+    Packed B(n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(reinterpret_cast<std::uintptr_t>(&A(i, 0)) % 64 == 0);
+    }
+
+    A.rank_one_update(0.5, x);
+    A.rank_two_update(2.0, x, y);
+    B.rank_one_update(0.5, px);
+    B.rank_two_update(2.0, px, py);
+
+    std::vector<grabin::aligned_math_vector<double>> xs(7, x);
+    std::vector<grabin::math_vector<double>> pxs(7, px);
+    A.rank_k_update(1.5, xs.begin(), xs.end(), y);
+    B.rank_k_update(1.5, pxs.begin(), pxs.end(), py);
+
+    A += A;
+    B += B;
+    A /= 3.0;
+    B /= 3.0;
+
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j < n; ++ j)
+    {
+        CHECK(A(i, j) == B(i, j));
+    }
+
+    // Итераторы перебирают элементы нижнего треугольника в том же порядке
+    CHECK(std::distance(A.begin(), A.end()) == n*(n+1)/2);
+    CHECK(std::equal(A.begin(), A.end(), B.begin(), B.end()));
+
+    auto const S = grabin::outer_square(x);
+    static_assert(std::is_same<std::decay_t<decltype(S)>, Matrix>::value, "");
+
+    auto const C = 2.0 * S / 4.0;
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j < n; ++ j)
+    {
+        CHECK(C(i, j) == 2.0 * (x[i] * x[j]) / 4.0);
+    }
+}
+
+#include <grabin/statistics/variance.hpp>
+
+TEST_CASE("symmetric_matrix : variance of aligned vectors")
+{
+    using Vector = grabin::aligned_math_vector<double>;
+    using Packed_vector = grabin::math_vector<double>;
+
+    auto const n = 11;
+
+    auto acc = grabin::variance_accumulator<Vector>(Vector(n));
+    auto acc_packed = grabin::variance_accumulator<Packed_vector>(Packed_vector(n));
+
+    static_assert(std::is_same<decltype(acc.variance()), grabin::aligned_symmetric_matrix<double>>::value, "");
+
+    std::vector<Vector> xs;
+
+    for(auto k = 0; k < 50; ++ k)
+    {
+        Vector x(n);
+        Packed_vector px(n);
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            x[i] = px[i] = std::sin(k * (i + 1.0)) + i;
+        }
+
+        acc(x);
+        acc_packed(px);
+        xs.push_back(x);
+    }
+
+    // Каждый элемент учитывается четыре раза, дисперсия при этом не меняется
+    acc.update_block(xs.begin(), xs.end());
+    auto const acc_copy = acc;
+    acc.merge(acc_copy);
+
+    for(auto const & x : xs)
+    {
+        acc_packed(Packed_vector(x));
+    }
+
+    auto const V = acc.variance();
+    auto const V_packed = acc_packed.variance();
+
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j < n; ++ j)
+    {
+        CHECK_THAT(V(i, j), Catch::Matchers::WithinAbs(V_packed(i, j), 1e-12));
+    }
+}
+
+TEST_CASE("symmetric_matrix : float storage updated in double")
+{
+    using Vector = grabin::math_vector<float>;
+
+    Vector const x{0.1f, -0.3f, 0.7f};
+    Vector const y{1.1f, 0.5f, -0.9f};
+    auto const alpha = 1.0 / 3;
+
+    auto C = grabin::outer_square(y);
+    auto const C_old = C;
+
+    auto & r = C.rank_one_update<double>(alpha, x);
+    REQUIRE(&r == &C);
+
+    auto D = C_old;
+    D.rank_two_update<double>(alpha, x, y);
+
+    auto const n = C.dim();
+
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j < n; ++ j)
+    {
+        auto const xi = double{x[i]};
+        auto const xj = double{x[j]};
+        auto const yi = double{y[i]};
+        auto const yj = double{y[j]};
+
+        CHECK(C(i, j) == static_cast<float>(C_old(i, j) + alpha * xi * xj));
+        CHECK(D(i, j) == static_cast<float>(C_old(i, j) + (alpha * xi * yj + alpha * yi * xj)));
+    }
+
+    // Отклонения от сдвига вычисляются в double
+    std::vector<Vector> xs;
+    for(auto k = 0; k < 10; ++ k)
+    {
+        xs.push_back(Vector{1000.0f + 0.125f * k, 1000.0f - 0.25f * k, 1000.0f});
+    }
+
+    grabin::math_vector<double> const shift{1000.0 + 1.0 / 3, 1000.0 - 1.0 / 3, 1000.0 + 0.1};
+
+    grabin::symmetric_matrix<float> S(3);
+    S.rank_k_update<double>(0.5, xs.begin(), xs.end(), shift);
+
+    grabin::symmetric_matrix<double> S_ref(3);
+    S_ref.rank_k_update(0.5, xs.begin(), xs.end(), shift);
+
+    for(auto i = 0*n; i < n; ++ i)
+    for(auto j = 0*n; j < n; ++ j)
+    {
+        CHECK(S(i, j) == Approx(S_ref(i, j)).epsilon(1e-6));
+    }
+}
@@ -0,0 +1,74 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef Z_GRABIN_TESTS_LINEAR_ALGEBRA_TEST_DATA_HPP_INCLUDED
+#define Z_GRABIN_TESTS_LINEAR_ALGEBRA_TEST_DATA_HPP_INCLUDED
+
+/** @file tests/linear_algebra/test_data.hpp
+ @brief Тестовые векторы и матрицы, общие для тестов линейной алгебры и параллельных алгоритмов
+*/
+
+#include <grabin/linear_algebra/math_vector.hpp>
+#include <grabin/linear_algebra/symmetric_matrix.hpp>
+
+#include <cmath>
+
+namespace grabin_test
+{
+    /** @brief Тестовый вектор
+    @tparam Vector тип вектора
+    @param n размерность
+    @param phase сдвиг, позволяющий получать разные векторы одной размерности
+    @return Вектор с элементами <tt> cos(0.3 * i + phase) </tt>
+    */
+    template <class Vector = grabin::math_vector<double>>
+    Vector make_test_vector(typename Vector::dimension_type n, double phase)
+    {
+        Vector x(n);
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            x[i] = std::cos(i * 0.3 + phase);
+        }
+
+        return x;
+    }
+
+    /** @brief Тестовая симметричная матрица
+    @tparam Matrix тип матрицы
+    @param n размерность
+    @return Матрица с элементами нижнего треугольника <tt> sin(0.5 * i + j) </tt>, к диагональным
+    элементам которой прибавлено 2
+    */
+    template <class Matrix = grabin::symmetric_matrix<double>>
+    Matrix make_test_matrix(typename Matrix::dimension_type n)
+    {
+        Matrix A(n);
+
+        for(auto i = 0*n; i < n; ++ i)
+        {
+            for(auto j = 0*n; j <= i; ++ j)
+            {
+                A(i, j) = std::sin(i * 0.5 + j) + (i == j ? 2.0 : 0.0);
+            }
+        }
+
+        return A;
+    }
+}
+// namespace grabin_test
+
+#endif
+// Z_GRABIN_TESTS_LINEAR_ALGEBRA_TEST_DATA_HPP_INCLUDED
@@ -0,0 +1,207 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/linear_algebra/math_vector.hpp>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("vector_expression : arithmetic is lazy")
+{
+    grabin::math_vector<int> const x{1, 2, 3, 4};
+    grabin::math_vector<int> const y{1, -2, 2, 3};
+
+    auto const e = x + y;
+
+    static_assert(!std::is_same<std::decay_t<decltype(e)>, grabin::math_vector<int>>::value,
+                  "operator+ must return expression");
+    static_assert(grabin::is_vector_expression<std::decay_t<decltype(e)>>::value,
+                  "operator+ must return expression");
+
+    REQUIRE(e.dim() == x.dim());
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        CHECK(e[i] == x[i] + y[i]);
+    }
+}
+
+TEST_CASE("vector_expression : linear combination")
+{
+    grabin::math_vector<double> const x{1.5, 2.0, -3.0};
+    grabin::math_vector<double> const y{0.5, -2.5, 4.0};
+    grabin::math_vector<double> const z{3.0, 1.0, -1.0};
+
+    auto const a = 2.0;
+    auto const b = -3.0;
+
+    grabin::math_vector<double> const r = a*x + b*y - z;
+
+    REQUIRE(r.dim() == x.dim());
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        CHECK(r[i] == a*x[i] + b*y[i] - z[i]);
+    }
+
+    grabin::math_vector<double> const q = (x - y) / 2.0 + z * b;
+
+    for(auto i = 0*x.dim(); i < x.dim(); ++ i)
+    {
+        CHECK(q[i] == (x[i] - y[i]) / 2.0 + z[i] * b);
+    }
+}
+
+TEST_CASE("vector_expression : dimensions are checked on construction")
+{
+    grabin::math_vector<int> const x{1, 2, 3, 4};
+    grabin::math_vector<int> const y{1, 2, 3};
+
+    CHECK_THROWS_AS(x - y, std::logic_error);
+    CHECK_THROWS_AS(2 * x + y, std::logic_error);
+    CHECK_THROWS_AS(x + y * 2, std::logic_error);
+}
+
+TEST_CASE("vector_expression : index is checked")
+{
+    grabin::math_vector<int> const x{1, 2, 3, 4};
+
+    auto const e = 2 * x - x;
+
+    CHECK_THROWS_AS(e[-1], std::logic_error);
+    CHECK_THROWS_AS(e[e.dim()], std::logic_error);
+}
+
+TEST_CASE("vector_expression : division by zero")
+{
+    grabin::math_vector<double> const x{1, 2, 3, 4};
+
+    CHECK_THROWS_AS(x / 0.0, std::logic_error);
+    CHECK_THROWS_AS((x + x) / 0, std::logic_error);
+}
+
+TEST_CASE("vector_expression : element type")
+{
+    grabin::math_vector<int> const x{1, 2, 3};
+
+    auto const e = x * 0.5;
+
+    static_assert(std::is_same<decltype(e[0]), double>::value, "int * double must be double");
+
+    grabin::math_vector<double> const r = e;
+
+    CHECK(r == (grabin::math_vector<double>{0.5, 1.0, 1.5}));
+}
+
+TEST_CASE("vector_expression : temporaries are stored by value")
+{
+    grabin::math_vector<int> const y{1, 2, 3};
+
+    auto const e = grabin::math_vector<int>{3, 2, 1} + y;
+
+    CHECK(e == (grabin::math_vector<int>{4, 4, 4}));
+}
+
+TEST_CASE("vector_expression : assignment with aliasing")
+{
+    grabin::math_vector<int> x{1, 2, 3};
+    grabin::math_vector<int> const y{1, -1, 2};
+
+    auto & r = (x = 2 * x + y);
+    REQUIRE(&r == &x);
+
+    CHECK(x == (grabin::math_vector<int>{3, 3, 8}));
+
+    x = x - y - y;
+
+    CHECK(x == (grabin::math_vector<int>{1, 5, 4}));
+
+    x = grabin::math_vector<int>{1, 2} * 3;
+
+    CHECK(x == (grabin::math_vector<int>{3, 6}));
+}
+
+TEST_CASE("vector_expression : compound assignment")
+{
+    grabin::math_vector<int> x{1, 2, 3};
+    grabin::math_vector<int> const y{1, -1, 2};
+
+    auto & r1 = (x += 2 * y);
+    REQUIRE(&r1 == &x);
+    CHECK(x == (grabin::math_vector<int>{3, 0, 7}));
+
+    auto & r2 = (x -= y - x);
+    REQUIRE(&r2 == &x);
+    CHECK(x == (grabin::math_vector<int>{5, 1, 12}));
+
+    CHECK_THROWS_AS(x += (grabin::math_vector<int>{1, 2} * 2), std::logic_error);
+    CHECK_THROWS_AS(x -= (grabin::math_vector<int>{1, 2} * 2), std::logic_error);
+}
+
+#include <grabin/linear_algebra/outer_product.hpp>
+#include <grabin/statistics/mean.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+TEST_CASE("vector_expression : iteration over elements")
+{
+    grabin::math_vector<double> const x{1, 2, 3};
+    grabin::math_vector<double> const y{4, 5, 6};
+
+    auto const expr = 2.0 * (x + y);
+
+    static_assert(std::is_same<std::iterator_traits<decltype(expr.begin())>::iterator_category,
+                               std::input_iterator_tag>::value, "");
+
+    CHECK(std::distance(expr.begin(), expr.end()) == 3);
+    CHECK(std::accumulate(expr.begin(), expr.end(), 0.0) == 42.0);
+    CHECK(expr.begin()[2] == 18.0);
+
+    std::vector<double> values(expr.begin(), expr.end());
+    CHECK(values == (std::vector<double>{10, 14, 18}));
+
+    auto const z = x - y / 2.0;
+    CHECK(std::equal(z.begin(), z.end(), grabin::math_vector<double>(z).begin()));
+}
+
+TEST_CASE("vector_expression : passed to functions iterating over vectors")
+{
+    grabin::math_vector<double> const x{1, 2, 3};
+    grabin::math_vector<double> const y{4, 5, 6};
+
+    grabin::symmetric_matrix<double> A(3);
+    A.rank_one_update(2.0, x - y);
+
+    grabin::symmetric_matrix<double> B(3);
+    B.rank_one_update(2.0, grabin::math_vector<double>(x - y));
+
+    CHECK(std::equal(A.begin(), A.end(), B.begin(), B.end()));
+
+    grabin::symmetric_matrix<double> C(3);
+    grabin::add_outer_square_of_difference(C, x + y, 2.0 * y, 1, 2);
+
+    grabin::symmetric_matrix<double> D(3);
+    grabin::add_outer_square_of_difference(D, grabin::math_vector<double>(x + y),
+                                           grabin::math_vector<double>(2.0 * y), 1, 2);
+
+    CHECK(std::equal(C.begin(), C.end(), D.begin(), D.end()));
+
+    grabin::math_vector<double> mean{0, 0, 0};
+    grabin::update_mean(mean, x + y, 1);
+    grabin::update_mean(mean, x - y, 2);
+
+    CHECK(mean == (grabin::math_vector<double>{1, 2, 3}));
+}
@@ -0,0 +1,299 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/parallel/accumulate.hpp>
+
+#include <grabin/statistics/pairwise.hpp>
+#include <grabin/statistics/regression.hpp>
+#include <grabin/statistics/variance.hpp>
+
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    std::vector<double> make_sample(std::size_t n)
+    {
+        std::vector<double> xs;
+        xs.reserve(n);
+
+        for(auto i = std::size_t{0}; i < n; ++ i)
+        {
+            xs.push_back(std::sin(i) * 10 + 100);
+        }
+
+        return xs;
+    }
+}
+
+TEST_CASE("parallel_accumulate : empty range")
+{
+    std::vector<double> const xs;
+
+    auto const acc = grabin::parallel_accumulate(xs.begin(), xs.end(),
+                                                 grabin::mean_accumulator<double>{});
+
+    CHECK(acc.count() == 0);
+}
+
+TEST_CASE("parallel_accumulate : variance")
+{
+    auto const xs = make_sample(10007);
+
+    grabin::variance_accumulator<double> acc_seq;
+    for(auto const & x : xs)
+    {
+        acc_seq(x);
+    }
+
+    for(auto threads : {1, 2, 3, 8})
+    for(auto grain : {0, 1, 100, 20000})
+    {
+        grabin::parallel_options options;
+        options.threads = threads;
+        options.grain_size = grain;
+
+        auto const acc = grabin::parallel_accumulate(xs.begin(), xs.end(),
+                                                     grabin::variance_accumulator<double>{},
+                                                     options);
+
+        REQUIRE(acc.count() == acc_seq.count());
+        CHECK_THAT(acc.mean(), Catch::Matchers::WithinAbs(acc_seq.mean(), 1e-10));
+        CHECK_THAT(acc.variance(), Catch::Matchers::WithinAbs(acc_seq.variance(), 1e-10));
+    }
+}
+
+TEST_CASE("parallel_accumulate : deterministic mode")
+{
+    auto const xs = make_sample(5000);
+
+    grabin::thread_pool pool(4);
+
+    grabin::parallel_options options;
+    options.pool = &pool;
+    options.grain_size = 64;
+    options.deterministic = true;
+
+    auto const acc_1 = grabin::parallel_accumulate(xs.begin(), xs.end(),
+                                                   grabin::variance_accumulator<double>{},
+                                                   options);
+
+    for(auto n = 0; n < 10; ++ n)
+    {
+        auto const acc_2 = grabin::parallel_accumulate(xs.begin(), xs.end(),
+                                                       grabin::variance_accumulator<double>{},
+                                                       options);
+
+        REQUIRE(acc_2.count() == acc_1.count());
+        REQUIRE(acc_2.mean() == acc_1.mean());
+        REQUIRE(acc_2.variance() == acc_1.variance());
+    }
+}
+
+TEST_CASE("parallel_accumulate : called from a task of the same pool")
+{
+    auto const xs = make_sample(5000);
+
+    grabin::thread_pool pool(2);
+
+    grabin::parallel_options options;
+    options.pool = &pool;
+    options.grain_size = 64;
+    options.deterministic = true;
+
+    auto const expected = grabin::parallel_accumulate(xs.begin(), xs.end(),
+                                                      grabin::variance_accumulator<double>{},
+                                                      options);
+
+    // Каждый поток пула ждёт результата вложенного вызова
+    auto const call = [&]
+    {
+        return grabin::parallel_accumulate(xs.begin(), xs.end(),
+                                           grabin::variance_accumulator<double>{}, options);
+    };
+
+    auto first = pool.submit(call);
+    auto second = pool.submit(call);
+
+    for(auto const & acc : {first.get(), second.get()})
+    {
+        REQUIRE(acc.count() == expected.count());
+        CHECK(acc.mean() == Approx(expected.mean()));
+        CHECK(acc.variance() == Approx(expected.variance()));
+    }
+}
+
+TEST_CASE("parallel_accumulate : reproducible mode does not depend on thread count")
+{
+    auto const xs = make_sample(100003);
+
+    using Accumulator = grabin::variance_accumulator<double>;
+
+    for(auto grain : {0, 1, 7, 100, 200000})
+    {
+        CAPTURE(grain);
+
+        auto const block_size = grain != 0 ? grain : 1024;
+
+        grabin::pairwise_accumulator<Accumulator> sequential(Accumulator{}, block_size);
+
+        for(auto const & x : xs)
+        {
+            sequential(x);
+        }
+
+        auto const expected = sequential.result();
+
+        for(auto threads : {1, 2, 3, 5, 8, 13, 32, 64})
+        {
+            CAPTURE(threads);
+
+            grabin::parallel_options options;
+            options.threads = threads;
+            options.grain_size = grain;
+            options.reproducible = true;
+
+            auto const acc = grabin::parallel_accumulate(xs.begin(), xs.end(), Accumulator{},
+                                                         options);
+
+            REQUIRE(acc.count() == expected.count());
+            REQUIRE(acc.mean() == expected.mean());
+            REQUIRE(acc.variance() == expected.variance());
+        }
+    }
+}
+
+TEST_CASE("parallel_accumulate : reproducible mode for vectors")
+{
+    using Vector = grabin::math_vector<double>;
+
+    std::vector<Vector> xs;
+    for(auto n = 0; n < 5000; ++ n)
+    {
+        xs.push_back(Vector{std::sin(n), std::cos(n) + 100, std::sin(2*n)});
+    }
+
+    auto const zero = grabin::variance_accumulator<Vector>(Vector(3));
+
+    grabin::parallel_options options;
+    options.threads = 1;
+    options.grain_size = 16;
+    options.reproducible = true;
+
+    auto const expected = grabin::parallel_accumulate(xs.begin(), xs.end(), zero, options);
+
+    for(auto threads : {2, 4, 7, 64})
+    {
+        options.threads = threads;
+
+        auto const acc = grabin::parallel_accumulate(xs.begin(), xs.end(), zero, options);
+
+        REQUIRE(acc.count() == expected.count());
+        CHECK(acc.mean() == expected.mean());
+
+        auto const V = acc.variance();
+        auto const V_expected = expected.variance();
+
+        CHECK(std::equal(V.begin(), V.end(), V_expected.begin(), V_expected.end()));
+    }
+}
+
+TEST_CASE("parallel_accumulate : regression with custom update")
+{
+    std::vector<std::pair<double, double>> points;
+
+    for(auto n = 0; n < 1000; ++ n)
+    {
+        auto const x = 0.01 * n;
+        points.emplace_back(x, -2.3 * x + 3.14);
+    }
+
+    using Accumulator = grabin::linear_regression_accumulator<double, double>;
+
+    grabin::parallel_options options;
+    options.threads = 4;
+
+    auto const acc = grabin::parallel_accumulate(points.begin(), points.end(), Accumulator{},
+                                                 [](Accumulator & acc, std::pair<double, double> const & p)
+                                                 { acc(p.first, p.second); },
+                                                 options);
+
+    REQUIRE(acc.count() == 1000);
+    CHECK_THAT(acc.effect(), Catch::Matchers::WithinAbs(-2.3, 1e-10));
+    CHECK_THAT(acc.intercept(), Catch::Matchers::WithinAbs(3.14, 1e-10));
+}
+
+TEST_CASE("parallel_accumulate : vectors")
+{
+    using Vector = grabin::math_vector<double>;
+
+    std::vector<Vector> xs;
+    for(auto n = 0; n < 2000; ++ n)
+    {
+        xs.push_back(Vector{std::sin(n), std::cos(n), std::sin(2*n)});
+    }
+
+    auto const zero = grabin::variance_accumulator<Vector>(Vector(3));
+
+    auto acc_seq = zero;
+    for(auto const & x : xs)
+    {
+        acc_seq(x);
+    }
+
+    grabin::parallel_options options;
+    options.threads = 3;
+
+    auto const acc = grabin::parallel_accumulate(xs.begin(), xs.end(), zero, options);
+
+    REQUIRE(acc.count() == acc_seq.count());
+
+    auto const V = acc.variance();
+    auto const V_seq = acc_seq.variance();
+
+    for(auto i = 0; i < 3; ++ i)
+    for(auto j = 0; j < 3; ++ j)
+    {
+        CHECK_THAT(V(i, j), Catch::Matchers::WithinAbs(V_seq(i, j), 1e-12));
+    }
+}
+
+TEST_CASE("parallel_accumulate : exceptions are propagated")
+{
+    auto const xs = make_sample(1000);
+
+    grabin::parallel_options options;
+    options.threads = 4;
+    options.grain_size = 10;
+
+    auto const update = [](grabin::mean_accumulator<double> & acc, double x)
+    {
+        if(acc.count() == 50)
+        {
+            throw std::runtime_error("update failed");
+        }
+
+        acc(x);
+    };
+
+    CHECK_THROWS_AS(grabin::parallel_accumulate(xs.begin(), xs.end(),
+                                                grabin::mean_accumulator<double>{}, update,
+                                                options),
+                    std::runtime_error);
+}
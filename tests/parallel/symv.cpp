@@ -0,0 +1,157 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/parallel/symv.hpp>
+
+#include <grabin/linear_algebra/math_vector_view.hpp>
+
+#include "../linear_algebra/test_data.hpp"
+
+#include <catch/catch.hpp>
+
+#include <stdexcept>
+
+TEST_CASE("parallel_symv : matches serial product")
+{
+    auto const n = 300;
+    auto const A = grabin_test::make_test_matrix(n);
+    auto const x = grabin_test::make_test_vector(n, 0.0);
+    auto const y0 = grabin_test::make_test_vector(n, 1.0);
+
+    auto expected = y0;
+    grabin::symv(1.5, A, x, -0.5, expected);
+
+    grabin::parallel_options options;
+    options.threads = 4;
+    options.grain_size = 1000;
+
+    auto y = y0;
+    grabin::parallel_symv(1.5, A, x, -0.5, y, options);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(y[i] == Approx(expected[i]));
+    }
+
+    // При одинаковом количестве задач результат воспроизводится
+    grabin::thread_pool pool(3);
+    options.pool = &pool;
+    options.threads = 0;
+
+    auto y1 = y0;
+    grabin::parallel_symv(1.5, A, x, -0.5, y1, options);
+
+    auto y2 = y0;
+    grabin::parallel_symv(1.5, A, x, -0.5, y2, options);
+
+    CHECK(y1 == y2);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(y1[i] == Approx(expected[i]));
+    }
+
+    // Разреженный результат
+    std::vector<double> table(2 * n);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        table[2 * i + 1] = y0[i];
+    }
+
+    grabin::parallel_symv(1.5, A, x, -0.5,
+                          grabin::make_strided_vector_view(table.data() + 1, n, 2), options);
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(table[2 * i + 1] == y1[i]);
+    }
+}
+
+TEST_CASE("parallel_symv : called from a task of the same pool")
+{
+    auto const n = 300;
+    auto const A = grabin_test::make_test_matrix(n);
+    auto const x = grabin_test::make_test_vector(n, 0.0);
+    auto const y0 = grabin_test::make_test_vector(n, 1.0);
+
+    grabin::thread_pool pool(1);
+
+    grabin::parallel_options options;
+    options.pool = &pool;
+    options.grain_size = 1000;
+    options.reproducible = true;
+
+    auto expected = y0;
+    grabin::parallel_symv(1.5, A, x, -0.5, expected, options);
+
+    auto y = y0;
+    pool.submit([&] { grabin::parallel_symv(1.5, A, x, -0.5, y, options); }).get();
+
+    CHECK(y == expected);
+}
+
+TEST_CASE("parallel_symv : reproducible mode does not depend on thread count")
+{
+    auto const n = 400;
+    auto const A = grabin_test::make_test_matrix(n);
+    auto const x = grabin_test::make_test_vector(n, 0.0);
+    auto const y0 = grabin_test::make_test_vector(n, 1.0);
+
+    grabin::parallel_options options;
+    options.threads = 1;
+    options.grain_size = 500;
+    options.reproducible = true;
+
+    auto expected = y0;
+    grabin::parallel_symv(1.5, A, x, -0.5, expected, options);
+
+    auto serial = y0;
+    grabin::symv(1.5, A, x, -0.5, serial);
+
+    for(auto threads : {2, 3, 8, 64})
+    {
+        options.threads = threads;
+
+        auto y = y0;
+        grabin::parallel_symv(1.5, A, x, -0.5, y, options);
+
+        CHECK(y == expected);
+    }
+
+    for(auto i = 0*n; i < n; ++ i)
+    {
+        CHECK(expected[i] == Approx(serial[i]));
+    }
+}
+
+TEST_CASE("parallel_symv : small matrices are multiplied serially")
+{
+    auto const n = 20;
+    auto const A = grabin_test::make_test_matrix(n);
+    auto const x = grabin_test::make_test_vector(n, 0.0);
+    auto const y0 = grabin_test::make_test_vector(n, 1.0);
+
+    auto expected = y0;
+    grabin::symv(2.0, A, x, 1.0, expected);
+
+    auto y = y0;
+    grabin::parallel_symv(2.0, A, x, 1.0, y);
+
+    CHECK(y == expected);
+
+    CHECK_THROWS_AS(grabin::parallel_symv(1.0, A, x, 0.0, grabin::math_vector<double>(3)),
+                    std::logic_error);
+}
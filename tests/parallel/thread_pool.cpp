@@ -0,0 +1,103 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/parallel/thread_pool.hpp>
+
+#include <catch/catch.hpp>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("thread_pool : size")
+{
+    grabin::thread_pool const pool(3);
+
+    REQUIRE(pool.size() == 3);
+
+    grabin::thread_pool const default_pool;
+
+    REQUIRE(default_pool.size() > 0);
+}
+
+TEST_CASE("thread_pool : submit")
+{
+    grabin::thread_pool pool(4);
+
+    std::vector<std::future<int>> results;
+
+    for(auto i = 0; i < 100; ++ i)
+    {
+        results.push_back(pool.submit([i] { return i * i; }));
+    }
+
+    for(auto i = 0; i < 100; ++ i)
+    {
+        CHECK(results[i].get() == i * i);
+    }
+}
+
+TEST_CASE("thread_pool : exceptions are passed through future")
+{
+    grabin::thread_pool pool(2);
+
+    auto result = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+
+    CHECK_THROWS_AS(result.get(), std::runtime_error);
+}
+
+TEST_CASE("thread_pool : destructor waits for tasks")
+{
+    std::atomic<int> counter{0};
+
+    {
+        grabin::thread_pool pool(2);
+
+        for(auto i = 0; i < 50; ++ i)
+        {
+            pool.submit([&counter] { ++ counter; });
+        }
+    }
+
+    CHECK(counter == 50);
+}
+
+TEST_CASE("thread_pool : submit_or_run from a worker runs the task inline")
+{
+    grabin::thread_pool pool(1);
+
+    CHECK_FALSE(pool.owns_current_thread());
+
+    auto outer = pool.submit([&pool]
+    {
+        auto const worker = std::this_thread::get_id();
+
+        // При единственном потоке ожидание задачи из очереди привело бы к взаимной блокировке
+        auto inner = pool.submit_or_run([&pool, worker]
+        {
+            return pool.owns_current_thread() && std::this_thread::get_id() == worker;
+        });
+
+        return inner.get();
+    });
+
+    CHECK(outer.get());
+
+    auto direct = pool.submit_or_run([&pool] { return pool.owns_current_thread(); });
+
+    CHECK(direct.get());
+}
@@ -0,0 +1,185 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/statistics/ewma.hpp>
+
+#include <grabin/linear_algebra/math_vector.hpp>
+#include <grabin/linear_algebra/math_vector_view.hpp>
+
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    // Веса элементов: первый элемент задаёт начальное значение, остальные учитываются с весом alpha
+    std::vector<double> ewma_weights(std::size_t n, double alpha)
+    {
+        std::vector<double> result(n);
+
+        for(auto k = 0*n; k < n; ++ k)
+        {
+            auto const w = (k == 0) ? 1.0 : alpha;
+            result[k] = w * std::pow(1 - alpha, double(n - 1 - k));
+        }
+
+        return result;
+    }
+
+    double test_value(std::size_t k)
+    {
+        return std::sin(double(k)) * 3.0 + double(k % 7) / 4.0;
+    }
+}
+
+TEST_CASE("ewma : smoothing factor from half-life")
+{
+    auto const alpha = grabin::ewma_smoothing_factor(10.0);
+
+    CHECK(std::pow(1 - alpha, 10.0) == Approx(0.5));
+    CHECK(grabin::ewma_smoothing_factor(1.0) == 0.5);
+
+    CHECK_THROWS_AS(grabin::ewma_smoothing_factor(0.0), std::logic_error);
+    CHECK_THROWS_AS(grabin::ewma_mean_accumulator<double>(0.0), std::logic_error);
+    CHECK_THROWS_AS(grabin::ewma_mean_accumulator<double>(1.5), std::logic_error);
+    CHECK_THROWS_AS(grabin::ewma_variance_accumulator<double>(-0.5), std::logic_error);
+}
+
+TEST_CASE("ewma : mean and variance match weighted formulas")
+{
+    auto const alpha = 0.1;
+    auto const N = 200;
+
+    grabin::ewma_mean_accumulator<double> mean_acc(alpha);
+    grabin::ewma_variance_accumulator<double> acc(alpha);
+
+    REQUIRE(acc.count() == 0);
+    REQUIRE(acc.mean() == 0.0);
+    REQUIRE(acc.variance() == 0.0);
+
+    acc(test_value(0));
+    REQUIRE(acc.mean() == test_value(0));
+    REQUIRE(acc.variance() == 0.0);
+
+    mean_acc(test_value(0));
+
+    for(auto k = 1; k < N; ++ k)
+    {
+        acc(test_value(k));
+        mean_acc(test_value(k));
+    }
+
+    auto const weights = ewma_weights(N, alpha);
+
+    auto m = 0.0;
+
+    for(auto k = 0*weights.size(); k < weights.size(); ++ k)
+    {
+        m += weights[k] * test_value(k);
+    }
+
+    auto s2 = 0.0;
+
+    for(auto k = 0*weights.size(); k < weights.size(); ++ k)
+    {
+        s2 += weights[k] * (test_value(k) - m) * (test_value(k) - m);
+    }
+
+    CHECK(acc.count() == N);
+    CHECK(acc.smoothing_factor() == alpha);
+    CHECK(mean_acc.mean() == acc.mean());
+    CHECK(acc.mean() == Approx(m));
+    CHECK(acc.variance() == Approx(s2));
+    CHECK(acc.standard_deviation() == Approx(std::sqrt(s2)));
+}
+
+TEST_CASE("ewma : constant input and integer elements")
+{
+    grabin::ewma_variance_accumulator<int> acc(grabin::ewma_smoothing_factor(5.0));
+
+    for(auto n = 0; n < 50; ++ n)
+    {
+        acc(7);
+    }
+
+    CHECK(acc.mean() == 7.0);
+    CHECK(acc.variance() == 0.0);
+
+    // Старые элементы забываются
+    for(auto n = 0; n < 200; ++ n)
+    {
+        acc(n % 2 == 0 ? 1 : 3);
+    }
+
+    CHECK(acc.mean() == Approx(2.0).epsilon(0.2));
+    CHECK(acc.variance() == Approx(1.0).epsilon(0.2));
+}
+
+TEST_CASE("ewma : covariance of vectors is kept in packed symmetric matrix")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const alpha = 0.05;
+    auto const N = 150;
+    auto const p = 3;
+
+    grabin::ewma_variance_accumulator<Vector> acc(Vector(p), alpha);
+    grabin::ewma_variance_accumulator<Vector> acc_view(Vector(p), alpha);
+    std::vector<grabin::ewma_variance_accumulator<double>>
+        components(p, grabin::ewma_variance_accumulator<double>(alpha));
+
+    std::vector<Vector> xs;
+
+    for(auto k = 0; k < N; ++ k)
+    {
+        Vector x{test_value(k), test_value(3 * k + 1), -2.0 * test_value(k) + test_value(k + 5)};
+        xs.push_back(x);
+
+        acc(x);
+        acc_view(grabin::make_math_vector_view(x.data(), x.dim()));
+
+        for(auto i = 0; i < p; ++ i)
+        {
+            components[i](x[i]);
+        }
+    }
+
+    CHECK(acc_view.mean() == acc.mean());
+    CHECK(std::equal(acc_view.variance().begin(), acc_view.variance().end(),
+                     acc.variance().begin()));
+
+    auto const weights = ewma_weights(N, alpha);
+
+    for(auto i = 0; i < p; ++ i)
+    for(auto j = 0; j <= i; ++ j)
+    {
+        auto c = 0.0;
+
+        for(auto k = 0; k < N; ++ k)
+        {
+            c += weights[k] * (xs[k][i] - acc.mean()[i]) * (xs[k][j] - acc.mean()[j]);
+        }
+
+        CHECK(acc.variance()(i, j) == Approx(c));
+    }
+
+    for(auto i = 0; i < p; ++ i)
+    {
+        CHECK(acc.mean()[i] == Approx(components[i].mean()));
+        CHECK(acc.variance()(i, i) == Approx(components[i].variance()));
+    }
+}
@@ -15,6 +15,14 @@
 
 #include <grabin/statistics/mean.hpp>
 
+#include <grabin/linear_algebra/math_vector.hpp>
+#include <grabin/linear_algebra/math_vector_view.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include <catch/catch.hpp>
 
 TEST_CASE("mean of empty set and one element")
@@ -65,7 +73,7 @@ TEST_CASE("mean of ints is double")
     auto const x2 = int{2};
 
     grabin::mean_accumulator<int> acc;
-    static_assert(std::is_same<decltype(acc.mean()), double const &>::value,
+    static_assert(std::is_same<std::decay_t<decltype(acc.mean())>, double>::value,
                   "mean of ints must be floating point");
 
     acc(x1)(x2);
@@ -131,3 +139,310 @@ TEST_CASE("mean of arithmetic progression - symmetric")
 
     REQUIRE_THAT(acc.mean(), Catch::Matchers::WithinAbs(0.0, 1e-10));
 }
+
+TEST_CASE("mean: merge")
+{
+    auto const N = 100;
+    auto const M = 37;
+
+    grabin::mean_accumulator<double> acc_seq;
+    grabin::mean_accumulator<double> acc_1;
+    grabin::mean_accumulator<double> acc_2;
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        auto const x = std::sin(n) + 10;
+
+        acc_seq(x);
+        (n < M ? acc_1 : acc_2)(x);
+    }
+
+    auto & r = acc_1.merge(acc_2);
+    REQUIRE(&r == &acc_1);
+
+    REQUIRE(acc_1.count() == acc_seq.count());
+    CHECK_THAT(acc_1.mean(), Catch::Matchers::WithinAbs(acc_seq.mean(), 1e-12));
+}
+
+TEST_CASE("mean: merge with empty")
+{
+    grabin::mean_accumulator<int> acc;
+    acc(1)(2)(4);
+
+    grabin::mean_accumulator<int> empty;
+
+    auto acc_1 = acc;
+    acc_1.merge(empty);
+
+    REQUIRE(acc_1.count() == acc.count());
+    CHECK(acc_1.mean() == acc.mean());
+
+    empty.merge(acc);
+
+    REQUIRE(empty.count() == acc.count());
+    CHECK(empty.mean() == acc.mean());
+}
+
+TEST_CASE("mean: remove is inverse of update")
+{
+    grabin::mean_accumulator<double> acc;
+    grabin::mean_accumulator<double> expected;
+
+    for(auto n = 0; n < 50; ++ n)
+    {
+        auto const x = std::sin(n) + 10;
+
+        acc(x);
+
+        if(n % 3 != 0)
+        {
+            expected(x);
+        }
+    }
+
+    for(auto n = 0; n < 50; n += 3)
+    {
+        acc.remove(std::sin(n) + 10);
+    }
+
+    REQUIRE(acc.count() == expected.count());
+    CHECK_THAT(acc.mean(), Catch::Matchers::WithinAbs(expected.mean(), 1e-12));
+
+    grabin::mean_accumulator<int> single;
+    single(42).remove(42);
+
+    CHECK(single.count() == 0);
+    CHECK(single.mean() == 0.0);
+}
+
+TEST_CASE("mean: subtract is inverse of merge")
+{
+    grabin::mean_accumulator<double> acc_1;
+    grabin::mean_accumulator<double> acc_2;
+
+    for(auto n = 0; n < 100; ++ n)
+    {
+        (n % 4 == 0 ? acc_1 : acc_2)(std::sin(n) + 10);
+    }
+
+    auto acc = acc_1;
+    acc.merge(acc_2);
+
+    auto & r = acc.subtract(acc_2);
+    REQUIRE(&r == &acc);
+
+    REQUIRE(acc.count() == acc_1.count());
+    CHECK_THAT(acc.mean(), Catch::Matchers::WithinAbs(acc_1.mean(), 1e-12));
+
+    acc.subtract(acc_1);
+
+    CHECK(acc.count() == 0);
+    CHECK(acc.mean() == 0.0);
+
+    acc_1.subtract(grabin::mean_accumulator<double>{});
+    CHECK(acc_1.count() == 25);
+}
+
+TEST_CASE("mean: deferred sum of integers is exact")
+{
+    using Accumulator = grabin::mean_accumulator<int>;
+    using Deferred = grabin::mean_accumulator<int, int, grabin::deferred_sum_policy>;
+
+    static_assert(std::is_same<Accumulator, Deferred>::value,
+                  "integers must use deferred summation by default");
+    static_assert(std::is_same<Accumulator::sum_type, long long>::value, "");
+
+    Accumulator acc_1;
+    Accumulator acc_2;
+
+    auto const big = std::numeric_limits<int>::max();
+
+    for(auto n = 0; n < 1000; ++ n)
+    {
+        (n % 2 == 0 ? acc_1 : acc_2)(big - n);
+    }
+
+    CHECK(acc_1.sum() == 500LL * big - 2 * (499 * 500 / 2));
+
+    auto acc = acc_1;
+    acc.merge(acc_2);
+
+    REQUIRE(acc.count() == 1000);
+    CHECK(acc.sum() == 1000LL * big - 999 * 1000 / 2);
+    CHECK(acc.mean() == big - 999.0 / 2);
+
+    acc.subtract(acc_2);
+    CHECK(acc.sum() == acc_1.sum());
+
+    acc.remove(big);
+    CHECK(acc.count() == 499);
+    CHECK(acc.sum() == acc_1.sum() - big);
+}
+
+TEST_CASE("mean: deferred sum of vectors and views")
+{
+    using Vector = grabin::math_vector<double>;
+
+    grabin::mean_accumulator<Vector, int, grabin::deferred_sum_policy> acc(Vector(2));
+    grabin::mean_accumulator<Vector> welford(Vector(2));
+
+    CHECK(acc.mean() == Vector(2));
+
+    std::vector<double> buffer{1.0, 2.0, 3.0, 5.0, 8.0, 13.0};
+
+    for(auto n = 0; n < 3; ++ n)
+    {
+        auto const x = grabin::make_math_vector_view(buffer.data() + 2 * n, 2);
+
+        acc(x);
+        welford(x);
+    }
+
+    CHECK(acc.sum() == Vector{12.0, 20.0});
+    CHECK(acc.mean()[0] == Approx(welford.mean()[0]));
+    CHECK(acc.mean()[1] == Approx(welford.mean()[1]));
+
+    acc.remove(grabin::make_math_vector_view(buffer.data(), 2));
+    CHECK(acc.mean() == Vector{5.5, 9.0});
+
+    CHECK_THROWS_AS(acc(Vector(3)), std::logic_error);
+}
+
+TEST_CASE("mean: compensated sum of floats")
+{
+    auto const N = 1000000;
+
+    grabin::mean_accumulator<float> welford;
+    grabin::mean_accumulator<float, int, grabin::compensated_sum_policy> compensated;
+
+    auto exact = 0.0L;
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        auto const x = 1.0f + static_cast<float>(n % 1000) * 1e-3f;
+
+        welford(x);
+        compensated(x);
+        exact += x;
+    }
+
+    auto const expected = static_cast<double>(exact / N);
+
+    CHECK(std::abs(compensated.mean() - expected) <= std::abs(welford.mean() - expected));
+    CHECK(compensated.mean() == Approx(expected).epsilon(1e-7));
+    CHECK(compensated.sum() == Approx(static_cast<double>(exact)).epsilon(1e-7));
+
+    auto copy = compensated;
+    copy.merge(compensated).subtract(compensated);
+
+    CHECK(copy.count() == N);
+    CHECK(copy.mean() == compensated.mean());
+
+    copy.remove(1.0f);
+    CHECK(copy.count() == N - 1);
+}
+
+TEST_CASE("mean: narrow elements accumulated in a wider type")
+{
+    using Wide = grabin::mean_accumulator<float, int, grabin::welford_policy, double>;
+    static_assert(std::is_same<Wide::mean_type, double>::value, "");
+
+    Wide wide;
+    grabin::mean_accumulator<double> reference;
+
+    for(auto n = 0; n < 100000; ++ n)
+    {
+        auto const x = 1.0f + static_cast<float>(n % 1000) * 1e-3f;
+
+        wide(x);
+        reference(x);
+    }
+
+    CHECK(wide.mean() == reference.mean());
+
+    using Short = grabin::mean_accumulator<std::int16_t, int, grabin::deferred_sum_policy, float>;
+    static_assert(std::is_same<Short::mean_type, float>::value, "");
+    static_assert(std::is_same<Short::sum_type, long long>::value, "");
+
+    Short acc;
+    acc(std::int16_t{32767})(std::int16_t{32767})(std::int16_t{-2});
+
+    CHECK(acc.sum() == 65532);
+    CHECK(acc.mean() == 21844.0f);
+
+    using Compensated = grabin::mean_accumulator<float, int, grabin::compensated_sum_policy,
+                                                 double>;
+    static_assert(std::is_same<Compensated::sum_type, double>::value, "");
+}
+
+TEST_CASE("mean: sums of 64-bit integers do not overflow")
+{
+    using Signed = grabin::mean_accumulator<long long>;
+    using Unsigned = grabin::mean_accumulator<unsigned long long>;
+
+#if defined(__SIZEOF_INT128__)
+    static_assert(std::is_same<Signed::sum_type, grabin::sum_type_t<long long>>::value, "");
+    static_assert(sizeof(Signed::sum_type) > sizeof(long long), "");
+    static_assert(sizeof(Unsigned::sum_type) > sizeof(unsigned long long), "");
+    static_assert(std::is_same<grabin::default_mean_policy_t<long long>,
+                               grabin::deferred_sum_policy>::value, "");
+#else
+    static_assert(std::is_same<grabin::default_mean_policy_t<long long>,
+                               grabin::welford_policy>::value, "");
+    static_assert(std::is_same<grabin::default_mean_policy_t<unsigned long long>,
+                               grabin::welford_policy>::value, "");
+#endif
+
+    auto const big = std::numeric_limits<long long>::max();
+    auto const huge = std::numeric_limits<unsigned long long>::max();
+
+    Signed acc_s;
+    Unsigned acc_u;
+
+    for(auto n = 0; n < 4; ++ n)
+    {
+        acc_s(big);
+        acc_u(huge);
+    }
+
+    CHECK(acc_s.count() == 4);
+    CHECK(acc_s.mean() == Approx(static_cast<double>(big)));
+    CHECK(acc_u.mean() == Approx(static_cast<double>(huge)));
+
+    acc_s.remove(big);
+    acc_u.remove(huge);
+
+    CHECK(acc_s.mean() == Approx(static_cast<double>(big)));
+    CHECK(acc_u.mean() == Approx(static_cast<double>(huge)));
+}
+
+TEST_CASE("mean: float vectors and views accumulated in double")
+{
+    using Vector = grabin::math_vector<float>;
+    using Wide = grabin::math_vector<double>;
+    using Accumulator = grabin::mean_accumulator<Vector, int, grabin::welford_policy, Wide>;
+
+    auto acc = Accumulator(Vector(2));
+    auto reference = grabin::mean_accumulator<Wide>(Wide(2));
+
+    std::vector<float> buffer{0.1f, 0.2f, 0.3f, 0.5f, 0.8f, 1.3f};
+
+    for(auto n = 0; n < 3; ++ n)
+    {
+        auto const x = grabin::make_math_vector_view(buffer.data() + 2 * n, 2);
+
+        acc(x);
+        acc(Vector{x[0], x[1]});
+        reference(Wide{x[0], x[1]});
+        reference(Wide{x[0], x[1]});
+    }
+
+    CHECK(acc.mean() == reference.mean());
+
+    acc.remove(grabin::make_math_vector_view(buffer.data(), 2));
+    reference.remove(Wide{buffer[0], buffer[1]});
+
+    CHECK(acc.mean() == reference.mean());
+
+    CHECK_THROWS_AS(acc(Vector(3)), std::logic_error);
+}
@@ -0,0 +1,77 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/statistics/pairwise.hpp>
+
+#include <grabin/statistics/regression.hpp>
+
+#include <catch/catch.hpp>
+
+#include <cmath>
+
+TEST_CASE("pairwise : mean of a long float stream")
+{
+    auto const N = 1000000;
+
+    grabin::mean_accumulator<float> sequential;
+    grabin::pairwise_accumulator<grabin::mean_accumulator<float>> pairwise;
+
+    auto exact = 0.0L;
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        auto const x = 1.0f + static_cast<float>(n % 1000) * 1e-3f;
+
+        sequential(x);
+        pairwise(x);
+        exact += x;
+    }
+
+    auto const expected = static_cast<double>(exact / N);
+    auto const result = pairwise.result();
+
+    CHECK(result.count() == N);
+    CHECK(std::abs(result.mean() - expected) <= std::abs(sequential.mean() - expected));
+    CHECK(result.mean() == Approx(expected).epsilon(1e-6));
+}
+
+TEST_CASE("pairwise : small streams and several arguments")
+{
+    using Accumulator = grabin::linear_regression_accumulator<double, double>;
+
+    grabin::pairwise_accumulator<Accumulator> pairwise(Accumulator(), 4);
+    Accumulator sequential;
+
+    CHECK(pairwise.block_size() == 4);
+    CHECK(pairwise.result().count() == 0);
+
+    for(auto n = 0; n < 37; ++ n)
+    {
+        auto const x = 0.1 * n + std::sin(n);
+        auto const y = 2.0 * x - 1.0 + std::cos(n);
+
+        pairwise(x, y);
+        sequential(x, y);
+
+        auto const result = pairwise.result();
+
+        REQUIRE(result.count() == sequential.count());
+        CHECK(result.effect() == Approx(sequential.effect()));
+        CHECK(result.intercept() == Approx(sequential.intercept()));
+    }
+
+    using Mean = grabin::mean_accumulator<double>;
+    CHECK_THROWS_AS(grabin::pairwise_accumulator<Mean>(Mean(), 0), std::logic_error);
+}
@@ -15,8 +15,13 @@
 
 #include <grabin/statistics/regression.hpp>
 
+#include <grabin/linear_algebra/math_vector_view.hpp>
+
 #include <catch/catch.hpp>
 
+#include <cmath>
+#include <vector>
+
 TEST_CASE("linear regression for empty set and singular element")
 {
     grabin::linear_regression_accumulator<double, double> acc;
@@ -126,3 +131,476 @@ TEST_CASE("linear regression for sample of identical elements")
 
     CHECK_THAT(a1*x0 + b1, Catch::Matchers::WithinAbs(a*x0 + b, 1e-10));
 }
+
+TEST_CASE("linear regression: merge")
+{
+    auto const N = 200;
+
+    grabin::linear_regression_accumulator<double, double> acc_seq;
+    grabin::linear_regression_accumulator<double, double> acc_1;
+    grabin::linear_regression_accumulator<double, double> acc_2;
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        auto const x = 0.1 * n + std::sin(n);
+        auto const y = -2.3 * x + 3.14 + std::cos(n);
+
+        acc_seq(x, y);
+        (n % 2 == 0 ? acc_1 : acc_2)(x, y);
+    }
+
+    auto & r = acc_1.merge(acc_2);
+    REQUIRE(&r == &acc_1);
+
+    REQUIRE(acc_1.count() == acc_seq.count());
+    CHECK_THAT(acc_1.effect(), Catch::Matchers::WithinAbs(acc_seq.effect(), 1e-10));
+    CHECK_THAT(acc_1.intercept(), Catch::Matchers::WithinAbs(acc_seq.intercept(), 1e-10));
+
+    grabin::linear_regression_accumulator<double, double> acc;
+    acc.merge(acc_seq);
+
+    REQUIRE(acc.count() == acc_seq.count());
+    CHECK(acc.effect() == acc_seq.effect());
+    CHECK(acc.intercept() == acc_seq.intercept());
+}
+
+TEST_CASE("linear regression: remove and subtract")
+{
+    auto const N = 120;
+    auto const K = 4;
+
+    using Accumulator = grabin::linear_regression_accumulator<double, double>;
+
+    Accumulator total;
+    std::vector<Accumulator> folds(K);
+
+    auto const make_x = [](int n) { return 0.1 * n + std::sin(n); };
+    auto const make_y = [](int n) { return -2.3 * (0.1 * n + std::sin(n)) + std::cos(n); };
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        total(make_x(n), make_y(n));
+        folds[n % K](make_x(n), make_y(n));
+    }
+
+    // Перекрёстная проверка: статистики без одной части
+    for(auto k = 0; k < K; ++ k)
+    {
+        Accumulator expected;
+
+        for(auto n = 0; n < N; ++ n)
+        {
+            if(n % K != k)
+            {
+                expected(make_x(n), make_y(n));
+            }
+        }
+
+        auto rest = total;
+        auto & r = rest.subtract(folds[k]);
+        REQUIRE(&r == &rest);
+
+        REQUIRE(rest.count() == expected.count());
+        CHECK_THAT(rest.effect(), Catch::Matchers::WithinAbs(expected.effect(), 1e-10));
+        CHECK_THAT(rest.intercept(), Catch::Matchers::WithinAbs(expected.intercept(), 1e-10));
+    }
+
+    // Исключение одного элемента
+    auto loo = total;
+    loo.remove(make_x(7), make_y(7));
+
+    Accumulator expected;
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        if(n != 7)
+        {
+            expected(make_x(n), make_y(n));
+        }
+    }
+
+    REQUIRE(loo.count() == expected.count());
+    CHECK_THAT(loo.effect(), Catch::Matchers::WithinAbs(expected.effect(), 1e-10));
+    CHECK_THAT(loo.intercept(), Catch::Matchers::WithinAbs(expected.intercept(), 1e-10));
+
+    auto empty = total;
+    empty.subtract(total);
+
+    CHECK(empty.count() == 0);
+    CHECK(empty.effect() == 0.0);
+    CHECK(empty.intercept() == 0.0);
+}
+
+TEST_CASE("linear regression: compensated summation with float storage")
+{
+    grabin::linear_regression_accumulator<float, float, int, grabin::compensated_sum_policy> acc;
+    grabin::linear_regression_accumulator<double, double> reference;
+
+    for(auto n = 0; n < 100000; ++ n)
+    {
+        auto const x = 500.0f + static_cast<float>(n % 101) * 0.125f;
+        auto const y = -2.0f * x + 3.0f + static_cast<float>(std::sin(n));
+
+        acc(x, y);
+        reference(x, y);
+    }
+
+    CHECK(acc.effect() == Approx(reference.effect()).epsilon(1e-5));
+    CHECK(acc.intercept() == Approx(reference.intercept()).epsilon(1e-4));
+
+    auto rest = acc;
+    rest.remove(500.0f, -997.0f + static_cast<float>(std::sin(0)));
+
+    CHECK(rest.count() == acc.count() - 1);
+
+    rest.subtract(rest);
+
+    CHECK(rest.count() == 0);
+    CHECK(rest.effect() == 0.0f);
+}
+
+namespace
+{
+    // y = 1.5 - 2 * x0 + 0.5 * x1 + 3 * x2
+    double multiple_regression_output(grabin::math_vector<double> const & x)
+    {
+        return 1.5 - 2.0 * x[0] + 0.5 * x[1] + 3.0 * x[2];
+    }
+
+    grabin::math_vector<double> multiple_regression_input(int i)
+    {
+        return grabin::math_vector<double>{std::sin(i * 0.9), std::cos(i * 1.7), i * 0.01};
+    }
+}
+
+TEST_CASE("multiple linear regression for sample with no noise")
+{
+    grabin::multiple_linear_regression_accumulator<grabin::math_vector<double>>
+        acc(grabin::math_vector<double>(3));
+
+    CHECK(acc.count() == 0);
+    CHECK(acc.effect() == grabin::math_vector<double>(3));
+    CHECK(acc.intercept() == 0.0);
+
+    for(auto i = 0; i < 50; ++ i)
+    {
+        auto const x = multiple_regression_input(i);
+        acc(x, multiple_regression_output(x));
+    }
+
+    REQUIRE(acc.count() == 50);
+
+    auto const effect = acc.effect();
+
+    CHECK(effect[0] == Approx(-2.0));
+    CHECK(effect[1] == Approx(0.5));
+    CHECK(effect[2] == Approx(3.0));
+    CHECK(acc.intercept() == Approx(1.5));
+
+    auto const x = multiple_regression_input(100);
+    CHECK(acc.intercept() + grabin::dot(effect, x) == Approx(multiple_regression_output(x)));
+}
+
+TEST_CASE("multiple linear regression: views and merge")
+{
+    using Accumulator
+        = grabin::multiple_linear_regression_accumulator<grabin::math_vector<double>>;
+
+    Accumulator acc(grabin::math_vector<double>(3));
+    Accumulator acc_view(grabin::math_vector<double>(3));
+    Accumulator acc_1(grabin::math_vector<double>(3));
+    Accumulator acc_2(grabin::math_vector<double>(3));
+
+    for(auto i = 0; i < 40; ++ i)
+    {
+        auto const x = multiple_regression_input(i);
+        auto const y = multiple_regression_output(x) + std::sin(i * 3.1) * 0.1;
+
+        acc(x, y);
+        acc_view(grabin::make_math_vector_view(x.data(), x.dim()), y);
+        (i < 15 ? acc_1 : acc_2)(x, y);
+    }
+
+    CHECK(acc_view.effect() == acc.effect());
+    CHECK(acc_view.intercept() == acc.intercept());
+
+    acc_1.merge(acc_2);
+
+    REQUIRE(acc_1.count() == acc.count());
+
+    auto const effect = acc.effect();
+    auto const merged = acc_1.effect();
+
+    for(auto i = 0*effect.dim(); i < effect.dim(); ++ i)
+    {
+        CHECK(merged[i] == Approx(effect[i]));
+    }
+
+    CHECK(acc_1.intercept() == Approx(acc.intercept()));
+    CHECK(acc_1.output_mean() == Approx(acc.output_mean()));
+}
+
+TEST_CASE("multiple linear regression: degenerate inputs")
+{
+    grabin::multiple_linear_regression_accumulator<grabin::math_vector<double>>
+        acc(grabin::math_vector<double>(2));
+
+    acc(grabin::math_vector<double>{1.0, 2.0}, 3.0);
+
+    CHECK(acc.effect() == grabin::math_vector<double>(2));
+    CHECK(acc.intercept() == 3.0);
+
+    // Линейно зависимые входные переменные
+    acc(grabin::math_vector<double>{2.0, 4.0}, 5.0);
+    acc(grabin::math_vector<double>{3.0, 6.0}, 7.0);
+
+    CHECK_THROWS_AS(acc.effect(), grabin::factorization_error);
+    CHECK_THROWS_AS(acc(grabin::math_vector<double>(3), 1.0), std::logic_error);
+    CHECK(acc.count() == 3);
+}
+
+TEST_CASE("multiple linear regression: remove and subtract")
+{
+    using Vector = grabin::math_vector<double>;
+    using Accumulator = grabin::multiple_linear_regression_accumulator<Vector>;
+
+    Accumulator total(Vector(3));
+    Accumulator fold(Vector(3));
+    Accumulator rest(Vector(3));
+
+    for(auto i = 0; i < 60; ++ i)
+    {
+        auto const x = multiple_regression_input(i);
+        auto const y = multiple_regression_output(x) + std::sin(i * 3.1) * 0.1;
+
+        total(x, y);
+        (i % 3 == 0 ? fold : rest)(x, y);
+    }
+
+    auto const check_equal = [](Accumulator const & actual, Accumulator const & expected)
+    {
+        REQUIRE(actual.count() == expected.count());
+
+        auto const effect = actual.effect();
+        auto const expected_effect = expected.effect();
+
+        for(auto i = 0*effect.dim(); i < effect.dim(); ++ i)
+        {
+            CHECK(effect[i] == Approx(expected_effect[i]));
+        }
+
+        CHECK(actual.intercept() == Approx(expected.intercept()));
+    };
+
+    auto without_fold = total;
+    without_fold.subtract(fold);
+    check_equal(without_fold, rest);
+
+    // Исключение элементов части по одному, в том числе заданных представлениями
+    auto removed = total;
+
+    for(auto i = 0; i < 60; i += 3)
+    {
+        auto const x = multiple_regression_input(i);
+        auto const y = multiple_regression_output(x) + std::sin(i * 3.1) * 0.1;
+
+        if(i % 2 == 0)
+        {
+            removed.remove(x, y);
+        }
+        else
+        {
+            removed.remove(grabin::make_math_vector_view(x.data(), x.dim()), y);
+        }
+    }
+
+    check_equal(removed, rest);
+
+    CHECK_THROWS_AS(removed.remove(Vector(2), 1.0), std::logic_error);
+
+    auto empty = total;
+    empty.subtract(total);
+
+    CHECK(empty.count() == 0);
+    CHECK(empty.effect() == Vector(3));
+}
+
+TEST_CASE("recursive least squares without forgetting")
+{
+    using Vector = grabin::math_vector<double>;
+
+    grabin::recursive_least_squares_accumulator<Vector> rls(Vector(3), 1.0, 1e-9);
+    grabin::multiple_linear_regression_accumulator<Vector> batch(Vector(3));
+
+    CHECK(rls.count() == 0);
+    CHECK(rls.effect() == Vector(3));
+    CHECK(rls.intercept() == 0.0);
+    CHECK(rls.forgetting_factor() == 1.0);
+    CHECK(rls.inverse_moments()(0, 0) == Approx(1e9));
+
+    for(auto i = 0; i < 60; ++ i)
+    {
+        auto const x = multiple_regression_input(i);
+        auto const y = multiple_regression_output(x) + std::sin(i * 3.1) * 0.1;
+
+        rls(x, y);
+        batch(x, y);
+    }
+
+    REQUIRE(rls.count() == 60);
+
+    // Без забывания метод совпадает с обычным методом наименьших квадратов
+    auto const effect = batch.effect();
+
+    for(auto i = 0*effect.dim(); i < effect.dim(); ++ i)
+    {
+        CHECK(rls.effect()[i] == Approx(effect[i]).epsilon(1e-6));
+    }
+
+    CHECK(rls.intercept() == Approx(batch.intercept()).epsilon(1e-6));
+
+    // Обратная матрица моментов симметрична по построению и обратна к сумме z * z^T
+    auto const & P = rls.inverse_moments();
+    Vector z{1.0, 0.3, -0.2, 0.5};
+    Vector Mz(4);
+
+    for(auto i = 0; i < 60; ++ i)
+    {
+        auto const x = multiple_regression_input(i);
+        Vector const zi{1.0, x[0], x[1], x[2]};
+        Mz += zi * grabin::dot(zi, z);
+    }
+
+    auto const PMz = P * Mz;
+
+    for(auto i = 0*z.dim(); i < z.dim(); ++ i)
+    {
+        CHECK(PMz[i] == Approx(z[i]).epsilon(1e-6));
+    }
+}
+
+TEST_CASE("recursive least squares tracks drifting coefficients")
+{
+    using Vector = grabin::math_vector<double>;
+
+    grabin::recursive_least_squares_accumulator<Vector> forgetting(Vector(3), 0.9);
+    grabin::recursive_least_squares_accumulator<Vector> remembering(Vector(3));
+    grabin::recursive_least_squares_accumulator<Vector> with_views(Vector(3), 0.9);
+
+    for(auto i = 0; i < 400; ++ i)
+    {
+        auto const x = multiple_regression_input(i);
+        auto const y = (i < 200) ? multiple_regression_output(x)
+                                 : -1.0 + x[0] + 2.0 * x[1] - x[2];
+
+        forgetting(x, y);
+        remembering(x, y);
+        with_views(grabin::make_math_vector_view(x.data(), x.dim()), y);
+    }
+
+    CHECK(forgetting.effect()[0] == Approx(1.0));
+    CHECK(forgetting.effect()[1] == Approx(2.0));
+    CHECK(forgetting.effect()[2] == Approx(-1.0));
+    CHECK(forgetting.intercept() == Approx(-1.0));
+
+    CHECK(std::abs(remembering.effect()[1] - 2.0) > 0.1);
+
+    CHECK(with_views.effect() == forgetting.effect());
+    CHECK(with_views.intercept() == forgetting.intercept());
+}
+
+TEST_CASE("recursive least squares: invalid arguments")
+{
+    using Vector = grabin::math_vector<double>;
+    using RLS = grabin::recursive_least_squares_accumulator<Vector>;
+
+    CHECK_THROWS_AS(RLS(Vector(2), 0.0), std::logic_error);
+    CHECK_THROWS_AS(RLS(Vector(2), 1.5), std::logic_error);
+    CHECK_THROWS_AS(RLS(Vector(2), 1.0, 0.0), std::logic_error);
+
+    RLS rls(Vector(2));
+    CHECK_THROWS_AS(rls(Vector(3), 1.0), std::logic_error);
+    CHECK(rls.count() == 0);
+}
+
+TEST_CASE("linear regression: float samples accumulated in double")
+{
+    using Accumulator = grabin::linear_regression_accumulator<float, float, int,
+                                                              grabin::welford_policy, double>;
+
+    Accumulator acc;
+    grabin::linear_regression_accumulator<double> reference;
+
+    for(auto n = 0; n < 10000; ++ n)
+    {
+        auto const x = 1000.0f + static_cast<float>(n % 17) * 0.25f;
+        auto const y = 3.0f * x + static_cast<float>(std::sin(n));
+
+        acc(x, y);
+        reference(x, y);
+    }
+
+    CHECK(acc.effect() == static_cast<float>(reference.effect()));
+
+    // Коэффициент возвращается в float: его ошибка округления (не более половины единицы
+    // последнего разряда, около 1.2e-7 вблизи 3), умноженная на среднее x (около 1000), и
+    // определяет погрешность постоянного слагаемого
+    CHECK(acc.intercept() == Approx(reference.intercept()).margin(2e-4));
+}
+
+#include <grabin/linear_algebra/static_math_vector.hpp>
+
+TEST_CASE("recursive least squares with fixed-size input vectors")
+{
+    using Vector = grabin::static_math_vector<double, 2>;
+    using Dynamic = grabin::math_vector<double>;
+
+    grabin::recursive_least_squares_accumulator<Vector> rls(Vector{}, 1.0, 1e-9);
+    grabin::recursive_least_squares_accumulator<Dynamic> expected(Dynamic(2), 1.0, 1e-9);
+
+    for(auto i = 0; i < 40; ++ i)
+    {
+        Vector const x{std::sin(i * 0.9), std::cos(i * 1.7)};
+        auto const y = 1.5 - 2.0 * x[0] + 0.5 * x[1] + std::sin(i * 3.1) * 0.1;
+
+        rls(x, y);
+        expected(Dynamic{x[0], x[1]}, y);
+    }
+
+    CHECK(rls.count() == 40);
+    CHECK(rls.intercept() == Approx(expected.intercept()));
+    CHECK(rls.effect()[0] == Approx(expected.effect()[0]));
+    CHECK(rls.effect()[1] == Approx(expected.effect()[1]));
+    CHECK(rls.inverse_moments().dim() == 3);
+}
+
+TEST_CASE("linear regression: merge and subtract in long double")
+{
+    using Accumulator = grabin::linear_regression_accumulator<long double>;
+
+    Accumulator total;
+    Accumulator first;
+    Accumulator second;
+
+    for(auto i = 0; i < 1000; ++ i)
+    {
+        auto const x = std::sin(i * 0.7L) + 1e6L;
+        auto const y = 3.0L * x + std::cos(i * 1.3L);
+
+        total(x, y);
+        (i < 400 ? first : second)(x, y);
+    }
+
+    auto merged = first;
+    merged.merge(second);
+
+    CHECK(merged.count() == total.count());
+    CHECK(static_cast<double>(merged.effect())
+          == Approx(static_cast<double>(total.effect())).epsilon(1e-12));
+
+    total.subtract(second);
+
+    CHECK(total.count() == first.count());
+    CHECK(static_cast<double>(total.effect())
+          == Approx(static_cast<double>(first.effect())).epsilon(1e-9));
+}
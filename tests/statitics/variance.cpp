@@ -15,8 +15,13 @@
 
 #include <grabin/statistics/variance.hpp>
 
+#include <grabin/linear_algebra/math_vector.hpp>
+
 #include <catch/catch.hpp>
 
+#include <memory>
+#include <vector>
+
 TEST_CASE("variance of empty set and singular element")
 {
     grabin::variance_accumulator<double> acc;
@@ -114,3 +119,714 @@ TEST_CASE("variance of arithmetic progression")
     REQUIRE_THAT(acc.variance(), Catch::Matchers::WithinAbs(s2, 1e-10));
     REQUIRE_THAT(acc.standard_deviation(), Catch::Matchers::WithinAbs(s, 1e-10));
 }
+
+TEST_CASE("variance of vectors: in-place update matches formula with temporaries")
+{
+    using Vector = grabin::math_vector<double>;
+
+    std::vector<Vector> const xs{{-0.5, 1.3, 2.7}, {2.3, -3.14, 0.1}, {1.0/3, 2.0/7, -5.0/11},
+                                 {4.2, 0.3, -1.7}, {-2.5, 7.1, 0.9}};
+
+    auto const n = xs.front().dim();
+
+    auto acc = grabin::variance_accumulator<Vector>(Vector(n));
+
+    auto mean_expected = Vector(n);
+    auto S_expected = grabin::outer_square(mean_expected);
+    auto count = 0;
+
+    for(auto const & x : xs)
+    {
+        S_expected += grabin::outer_square(x - mean_expected) * count / (count + 1);
+        ++ count;
+        mean_expected += (x - mean_expected) / count;
+
+        acc(x);
+
+        REQUIRE(acc.count() == count);
+        CHECK(acc.mean() == mean_expected);
+
+        auto const V = acc.variance();
+        auto const V_expected = S_expected / count;
+
+        CHECK(std::equal(V.begin(), V.end(), V_expected.begin(), V_expected.end()));
+    }
+}
+
+namespace
+{
+    template <class T>
+    class counting_allocator
+    {
+    public:
+        using value_type = T;
+
+        explicit counting_allocator(int & allocations)
+         : allocations_(&allocations)
+        {}
+
+        template <class U>
+        counting_allocator(counting_allocator<U> const & other)
+         : allocations_(other.allocations())
+        {}
+
+        T * allocate(std::size_t n)
+        {
+            ++ *this->allocations_;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T * p, std::size_t n)
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        int * allocations() const
+        {
+            return this->allocations_;
+        }
+
+        friend bool operator==(counting_allocator const & x, counting_allocator const & y)
+        {
+            return x.allocations_ == y.allocations_;
+        }
+
+        friend bool operator!=(counting_allocator const & x, counting_allocator const & y)
+        {
+            return !(x == y);
+        }
+
+    private:
+        int * allocations_;
+    };
+}
+
+TEST_CASE("variance of vectors: update does not allocate after construction")
+{
+    using Alloc = counting_allocator<double>;
+    using Vector = grabin::math_vector<double, grabin::vector_policy_throws, Alloc>;
+
+    auto allocations = 0;
+    Alloc const alloc(allocations);
+
+    std::vector<Vector> xs;
+    for(auto k = 0; k < 10; ++ k)
+    {
+        xs.push_back(Vector{{std::sin(k), std::cos(k), 0.5 * k, 1.0 / (k + 1)}, alloc});
+    }
+
+    auto acc = grabin::variance_accumulator<Vector>(Vector(4, alloc));
+
+    auto const allocations_after_construction = allocations;
+
+    for(auto const & x : xs)
+    {
+        acc(x);
+    }
+
+    CHECK(acc.count() == 10);
+    CHECK(allocations == allocations_after_construction);
+}
+
+TEST_CASE("variance of vectors: dimension mismatch")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto acc = grabin::variance_accumulator<Vector>(Vector(3));
+
+    CHECK_THROWS_AS(acc(Vector{1.0, 2.0}), std::logic_error);
+}
+
+TEST_CASE("variance: block update of scalars")
+{
+    std::vector<double> xs;
+    for(auto n = 0; n < 1000; ++ n)
+    {
+        xs.push_back(std::sin(n) * 10 + 100);
+    }
+
+    grabin::variance_accumulator<double> acc_seq;
+    for(auto const & x : xs)
+    {
+        acc_seq(x);
+    }
+
+    grabin::variance_accumulator<double> acc;
+    auto & r = acc.update_block(xs.begin(), xs.begin() + 300);
+    REQUIRE(&r == &acc);
+
+    acc.update_block(xs.begin() + 300, xs.begin() + 300);
+    REQUIRE(acc.count() == 300);
+
+    acc.update_block(xs.begin() + 300, xs.end());
+
+    REQUIRE(acc.count() == acc_seq.count());
+    CHECK_THAT(acc.mean(), Catch::Matchers::WithinAbs(acc_seq.mean(), 1e-10));
+    CHECK_THAT(acc.variance(), Catch::Matchers::WithinAbs(acc_seq.variance(), 1e-10));
+}
+
+TEST_CASE("variance of vectors: block update")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const dim = 7;
+
+    std::vector<Vector> xs;
+    for(auto n = 0; n < 700; ++ n)
+    {
+        Vector x(dim);
+        for(auto i = 0*dim; i < dim; ++ i)
+        {
+            x[i] = std::sin(n * (i + 1)) * (i + 1) + 1000;
+        }
+        xs.push_back(x);
+    }
+
+    auto acc_seq = grabin::variance_accumulator<Vector>(Vector(dim));
+    for(auto const & x : xs)
+    {
+        acc_seq(x);
+    }
+
+    auto acc = grabin::variance_accumulator<Vector>(Vector(dim));
+    acc(xs.front());
+    acc.update_block(xs.begin() + 1, xs.begin() + 400);
+    acc.update_block(xs.begin() + 400, xs.end());
+
+    REQUIRE(acc.count() == acc_seq.count());
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    {
+        CHECK_THAT(acc.mean()[i], Catch::Matchers::WithinAbs(acc_seq.mean()[i], 1e-10));
+    }
+
+    auto const V = acc.variance();
+    auto const V_seq = acc_seq.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    for(auto j = 0*dim; j < dim; ++ j)
+    {
+        CHECK_THAT(V(i, j), Catch::Matchers::WithinAbs(V_seq(i, j), 1e-10));
+    }
+}
+
+TEST_CASE("variance: merge")
+{
+    auto const N = 1000;
+
+    grabin::variance_accumulator<double> acc_seq;
+    grabin::variance_accumulator<double> acc_1;
+    grabin::variance_accumulator<double> acc_2;
+    grabin::variance_accumulator<double> acc_3;
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        auto const x = std::sin(n) * 10 + 1e6;
+
+        acc_seq(x);
+        (n < 100 ? acc_1 : n < 700 ? acc_2 : acc_3)(x);
+    }
+
+    auto & r = acc_1.merge(acc_2);
+    REQUIRE(&r == &acc_1);
+
+    acc_1.merge(grabin::variance_accumulator<double>{});
+    acc_1.merge(acc_3);
+
+    REQUIRE(acc_1.count() == acc_seq.count());
+    CHECK_THAT(acc_1.mean(), Catch::Matchers::WithinAbs(acc_seq.mean(), 1e-8));
+    CHECK_THAT(acc_1.variance(), Catch::Matchers::WithinAbs(acc_seq.variance(), 1e-8));
+}
+
+TEST_CASE("variance of vectors: merge")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const dim = 3;
+    auto const zero = Vector(dim);
+
+    auto acc_seq = grabin::variance_accumulator<Vector>(zero);
+    auto acc_1 = grabin::variance_accumulator<Vector>(zero);
+    auto acc_2 = grabin::variance_accumulator<Vector>(zero);
+
+    for(auto n = 0; n < 500; ++ n)
+    {
+        Vector const x{std::sin(n), std::cos(3*n) * 2, std::sin(n) + std::cos(n)};
+
+        acc_seq(x);
+        (n % 3 == 0 ? acc_1 : acc_2)(x);
+    }
+
+    grabin::variance_accumulator<Vector> acc;
+    acc.merge(acc_1).merge(acc_2);
+
+    REQUIRE(acc.count() == acc_seq.count());
+
+    auto const V = acc.variance();
+    auto const V_seq = acc_seq.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    {
+        CHECK_THAT(acc.mean()[i], Catch::Matchers::WithinAbs(acc_seq.mean()[i], 1e-12));
+
+        for(auto j = 0*dim; j < dim; ++ j)
+        {
+            CHECK_THAT(V(i, j), Catch::Matchers::WithinAbs(V_seq(i, j), 1e-12));
+        }
+    }
+}
+
+TEST_CASE("variance of vectors: remove is inverse of update")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const dim = 3;
+    auto const zero = Vector(dim);
+
+    auto acc = grabin::variance_accumulator<Vector>(zero);
+    auto expected = grabin::variance_accumulator<Vector>(zero);
+
+    auto const make_x = [](int n)
+    {
+        return Vector{std::sin(n), std::cos(3*n) * 2, std::sin(n) + 5};
+    };
+
+    for(auto n = 0; n < 300; ++ n)
+    {
+        acc(make_x(n));
+
+        if(n >= 100)
+        {
+            expected(make_x(n));
+        }
+    }
+
+    for(auto n = 0; n < 100; ++ n)
+    {
+        acc.remove(make_x(n));
+    }
+
+    REQUIRE(acc.count() == expected.count());
+
+    auto const V = acc.variance();
+    auto const V_expected = expected.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    {
+        CHECK_THAT(acc.mean()[i], Catch::Matchers::WithinAbs(expected.mean()[i], 1e-12));
+
+        for(auto j = 0*dim; j < dim; ++ j)
+        {
+            CHECK_THAT(V(i, j), Catch::Matchers::WithinAbs(V_expected(i, j), 1e-12));
+        }
+    }
+
+    grabin::variance_accumulator<double> single;
+    single(3.0)(5.0).remove(3.0).remove(5.0);
+
+    CHECK(single.count() == 0);
+    CHECK(single.mean() == 0.0);
+    CHECK(single.variance() == 0.0);
+}
+
+TEST_CASE("variance of vectors: subtract is inverse of merge")
+{
+    using Vector = grabin::math_vector<double>;
+
+    auto const dim = 3;
+    auto const zero = Vector(dim);
+
+    auto total = grabin::variance_accumulator<Vector>(zero);
+    auto fold = grabin::variance_accumulator<Vector>(zero);
+    auto rest = grabin::variance_accumulator<Vector>(zero);
+
+    for(auto n = 0; n < 500; ++ n)
+    {
+        Vector const x{std::sin(n), std::cos(3*n) * 2, std::sin(n) + std::cos(n)};
+
+        total(x);
+        (n % 5 == 0 ? fold : rest)(x);
+    }
+
+    auto & r = total.subtract(fold);
+    REQUIRE(&r == &total);
+
+    REQUIRE(total.count() == rest.count());
+
+    auto const V = total.variance();
+    auto const V_rest = rest.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    {
+        CHECK_THAT(total.mean()[i], Catch::Matchers::WithinAbs(rest.mean()[i], 1e-12));
+
+        for(auto j = 0*dim; j < dim; ++ j)
+        {
+            CHECK_THAT(V(i, j), Catch::Matchers::WithinAbs(V_rest(i, j), 1e-12));
+        }
+    }
+
+    total.subtract(rest);
+
+    CHECK(total.count() == 0);
+    CHECK(total.mean() == zero);
+}
+
+// Точные суммы степеней требуют 128-битного целого типа
+#if defined(__SIZEOF_INT128__)
+TEST_CASE("variance of integers: exact power sums")
+{
+    using Accumulator = grabin::variance_accumulator<int>;
+    using Exact = grabin::variance_accumulator<int, int, grabin::default_tensor_algebra,
+                                               grabin::exact_power_sums_policy>;
+
+    static_assert(std::is_same<Accumulator, Exact>::value,
+                  "integers must use exact power sums by default");
+
+    // Большое смещение относительно разброса
+    auto const offset = 1000000000;
+
+    Accumulator acc;
+
+    for(auto n = 0; n < 1000; ++ n)
+    {
+        acc(offset + n % 3);
+    }
+
+    CHECK(acc.count() == 1000);
+    CHECK(acc.sum() == 1000LL * offset + 999);
+    CHECK(acc.mean() == Approx(offset + 0.999));
+
+    // Значения 0, 1, 2 встречаются 334, 333 и 333 раза
+    auto const mean = 999.0 / 1000;
+    auto const expected = (334 * mean * mean + 333 * (1 - mean) * (1 - mean)
+                           + 333 * (2 - mean) * (2 - mean)) / 1000;
+
+    CHECK_THAT(acc.variance(), Catch::Matchers::WithinULP(expected, 4));
+
+    Accumulator constant;
+
+    for(auto n = 0; n < 10; ++ n)
+    {
+        constant(-offset);
+    }
+
+    CHECK(constant.mean() == -offset);
+    CHECK(constant.variance() == 0.0);
+}
+
+TEST_CASE("variance of integers: exact power sums keep the interface of the primary template")
+{
+    using Accumulator = grabin::variance_accumulator<int>;
+
+    static_assert(std::is_same<Accumulator::tensor_algebra,
+                               grabin::default_tensor_algebra<double>>::value, "");
+
+    Accumulator acc(0);
+
+    CHECK(acc.count() == 0);
+    CHECK(acc.mean() == 0.0);
+    CHECK(acc.variance() == 0.0);
+
+    acc(3)(5);
+
+    CHECK(acc.mean() == 4.0);
+    CHECK(acc.variance() == 1.0);
+}
+#endif
+
+TEST_CASE("variance of integers: wide types use Welford method by default")
+{
+    static_assert(std::is_same<grabin::default_variance_policy_t<long long>,
+                               grabin::welford_policy>::value,
+                  "sums of squares of 64-bit integers may overflow");
+    static_assert(std::is_same<grabin::default_variance_policy_t<unsigned long long>,
+                               grabin::welford_policy>::value,
+                  "sums of squares of 64-bit integers may overflow");
+
+#if !defined(__SIZEOF_INT128__)
+    static_assert(std::is_same<grabin::default_variance_policy_t<int>,
+                               grabin::welford_policy>::value,
+                  "sums of squares require 128-bit integer type");
+#endif
+
+    grabin::variance_accumulator<long long> acc;
+
+    auto const big = 3000000000000000000LL;
+
+    acc(big);
+    acc(big + 2);
+
+    CHECK(acc.count() == 2);
+    CHECK(acc.mean() == Approx(3e18));
+    CHECK(acc.variance() >= 0.0);
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST_CASE("variance of integers: merge is exact and order independent")
+{
+    using Accumulator = grabin::variance_accumulator<int>;
+
+    Accumulator sequential;
+    std::vector<Accumulator> parts(7);
+
+    for(auto n = 0; n < 10000; ++ n)
+    {
+        auto const x = (n * 7919) % 10007 - 5000;
+
+        sequential(x);
+        parts[n % parts.size()](x);
+    }
+
+    Accumulator forward;
+    Accumulator backward;
+
+    for(auto i = 0*parts.size(); i < parts.size(); ++ i)
+    {
+        forward.merge(parts[i]);
+        backward.merge(parts[parts.size() - 1 - i]);
+    }
+
+    CHECK(forward.count() == sequential.count());
+    CHECK(forward.sum() == sequential.sum());
+    CHECK(forward.sum_of_squares() == sequential.sum_of_squares());
+    CHECK(forward.variance() == sequential.variance());
+    CHECK(backward.variance() == sequential.variance());
+    CHECK(backward.mean() == sequential.mean());
+
+    forward.subtract(parts[0]);
+    backward.merge(parts[0]).subtract(parts[0]).subtract(parts[0]);
+
+    CHECK(forward.sum_of_squares() == backward.sum_of_squares());
+    CHECK(forward.variance() == backward.variance());
+
+    Accumulator single;
+    single(3).remove(3);
+
+    CHECK(single.count() == 0);
+    CHECK(single.mean() == 0.0);
+    CHECK(single.variance() == 0.0);
+}
+#endif
+
+TEST_CASE("variance of float vectors: compensated summation")
+{
+    using Vector = grabin::math_vector<float>;
+    using Reference = grabin::math_vector<double>;
+    using Accumulator = grabin::variance_accumulator<Vector, int, grabin::default_tensor_algebra,
+                                                     grabin::compensated_sum_policy>;
+
+    auto const dim = 2;
+    auto const N = 200000;
+
+    auto compensated = Accumulator(Vector(dim));
+    auto plain = grabin::variance_accumulator<Vector>(Vector(dim));
+    auto reference = grabin::variance_accumulator<Reference>(Reference(dim));
+
+    auto part_1 = Accumulator(Vector(dim));
+    auto part_2 = Accumulator(Vector(dim));
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        Vector const x{100.0f + static_cast<float>(std::sin(n)),
+                       static_cast<float>(std::cos(3 * n)) * 0.5f - 7.0f};
+
+        compensated(x);
+        plain(x);
+        reference(Reference{x[0], x[1]});
+        (n % 3 == 0 ? part_1 : part_2)(x);
+    }
+
+    auto const V = compensated.variance();
+    auto const V_plain = plain.variance();
+    auto const V_ref = reference.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    {
+        CHECK(compensated.mean()[i] == Approx(reference.mean()[i]).epsilon(1e-7));
+
+        for(auto j = 0*dim; j <= i; ++ j)
+        {
+            CHECK(std::abs(V(i, j) - V_ref(i, j)) <= std::abs(V_plain(i, j) - V_ref(i, j)));
+            CHECK(V(i, j) == Approx(V_ref(i, j)).epsilon(1e-5).margin(1e-6));
+        }
+    }
+
+    auto merged = part_1;
+    merged.merge(part_2);
+
+    auto rest = compensated;
+    rest.subtract(part_2);
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    {
+        CHECK(merged.mean()[i] == Approx(compensated.mean()[i]).epsilon(1e-7));
+        CHECK(rest.mean()[i] == Approx(part_1.mean()[i]).epsilon(1e-7));
+
+        for(auto j = 0*dim; j <= i; ++ j)
+        {
+            CHECK(merged.variance()(i, j) == Approx(V(i, j)).epsilon(1e-5).margin(1e-6));
+            CHECK(rest.variance()(i, j)
+                  == Approx(part_1.variance()(i, j)).epsilon(1e-5).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("variance: compensated summation of scalars")
+{
+    using Accumulator = grabin::variance_accumulator<float, int, grabin::default_tensor_algebra,
+                                                     grabin::compensated_sum_policy>;
+
+    Accumulator acc;
+    grabin::variance_accumulator<double> reference;
+
+    for(auto n = 0; n < 100000; ++ n)
+    {
+        auto const x = 1000.0f + static_cast<float>(n % 17) * 0.25f;
+
+        acc(x);
+        reference(x);
+    }
+
+    CHECK(acc.mean() == Approx(reference.mean()).epsilon(1e-7));
+    CHECK(acc.variance() == Approx(reference.variance()).epsilon(1e-5));
+    CHECK(acc.standard_deviation() == Approx(reference.standard_deviation()).epsilon(1e-5));
+
+    std::vector<float> const block{1.5f, 2.0f, 3.25f, -4.0f, 7.5f};
+
+    Accumulator by_block;
+    by_block.update_block(block.begin(), block.end());
+
+    Accumulator by_element;
+    for(auto const & x : block)
+    {
+        by_element(x);
+    }
+
+    CHECK(by_block.count() == by_element.count());
+    CHECK(by_block.mean() == by_element.mean());
+    CHECK(by_block.variance() == by_element.variance());
+
+    Accumulator single;
+    single(3.0f)(5.0f);
+
+    CHECK(single.variance() == 1.0f);
+
+    single.remove(5.0f);
+
+    CHECK(single.mean() == 3.0f);
+    CHECK(single.variance() == 0.0f);
+
+    single.remove(3.0f);
+
+    CHECK(single.count() == 0);
+    CHECK(single.mean() == 0.0f);
+}
+
+TEST_CASE("variance: float elements accumulated in double")
+{
+    using Accumulator = grabin::variance_accumulator<float, int, grabin::default_tensor_algebra,
+                                                     grabin::welford_policy, double>;
+
+    static_assert(std::is_same<Accumulator::mean_type, double>::value, "");
+    static_assert(std::is_same<Accumulator::variance_type, double>::value, "");
+
+    Accumulator acc;
+    grabin::variance_accumulator<double> reference;
+
+    for(auto n = 0; n < 10000; ++ n)
+    {
+        auto const x = 1000.0f + static_cast<float>(n % 17) * 0.25f;
+
+        acc(x);
+        reference(x);
+    }
+
+    CHECK(acc.mean() == reference.mean());
+    CHECK(acc.variance() == reference.variance());
+}
+
+TEST_CASE("variance of float vectors: float matrix with double mean")
+{
+    using Vector = grabin::math_vector<float>;
+    using Wide = grabin::math_vector<double>;
+    using Accumulator = grabin::variance_accumulator<Vector, int,
+                                                     grabin::tensor_storage<float>::algebra,
+                                                     grabin::welford_policy, Wide>;
+
+    static_assert(std::is_same<Accumulator::mean_type, Wide>::value, "");
+    static_assert(std::is_same<Accumulator::variance_type,
+                               grabin::symmetric_matrix<float>>::value, "");
+
+    auto const dim = 3;
+    auto const N = 20000;
+
+    auto acc = Accumulator(Vector(dim));
+    auto block = Accumulator(Vector(dim));
+    auto plain = grabin::variance_accumulator<Vector>(Vector(dim));
+    auto reference = grabin::variance_accumulator<Wide>(Wide(dim));
+
+    std::vector<Vector> xs;
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        Vector x(dim);
+
+        for(auto i = 0*dim; i < dim; ++ i)
+        {
+            x[i] = 100.0f + static_cast<float>(std::sin(n * (i + 1))) * (i + 1);
+        }
+
+        acc(x);
+        plain(x);
+        reference(Wide(x));
+        xs.push_back(x);
+    }
+
+    block(xs.front());
+    block.update_block(xs.begin() + 1, xs.end());
+
+    auto const V = acc.variance();
+    auto const V_block = block.variance();
+    auto const V_ref = reference.variance();
+
+    for(auto i = 0*dim; i < dim; ++ i)
+    {
+        CHECK(acc.mean()[i] == Approx(reference.mean()[i]).epsilon(1e-12));
+        CHECK(block.mean()[i] == Approx(reference.mean()[i]).epsilon(1e-12));
+        CHECK(std::abs(acc.mean()[i] - reference.mean()[i])
+              <= std::abs(plain.mean()[i] - reference.mean()[i]));
+
+        for(auto j = 0*dim; j <= i; ++ j)
+        {
+            CHECK(V(i, j) == Approx(V_ref(i, j)).epsilon(1e-5).margin(1e-6));
+            CHECK(V_block(i, j) == Approx(V_ref(i, j)).epsilon(1e-6).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("variance of vectors: compensated summation checks dimensions")
+{
+    using Vector = grabin::math_vector<double>;
+    using Accumulator = grabin::variance_accumulator<Vector, int, grabin::default_tensor_algebra,
+                                                     grabin::compensated_sum_policy>;
+
+    auto acc = Accumulator(Vector(3));
+
+    CHECK_THROWS_AS(acc(Vector(2)), std::logic_error);
+    CHECK(acc.count() == 0);
+
+    acc(Vector{1, 2, 3});
+
+    CHECK_THROWS_AS(acc(Vector(4)), std::logic_error);
+    CHECK_THROWS_AS(acc.remove(Vector(2)), std::logic_error);
+    CHECK(acc.count() == 1);
+
+    auto other = Accumulator(Vector(2));
+    other(Vector{1, 2});
+
+    CHECK_THROWS_AS(acc.merge(other), std::logic_error);
+    CHECK_THROWS_AS(acc.subtract(other), std::logic_error);
+    CHECK(acc.count() == 1);
+    CHECK(acc.mean() == Vector{1, 2, 3});
+}
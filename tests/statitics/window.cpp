@@ -0,0 +1,209 @@
+/**
+   Этот файл — часть библиотеки Grabin.
+
+   Grabin - свободное программное обеспечение: вы можете перераспространять его и/или изменять ее на
+   условиях Стандартной общественной лицензии GNU либо версии 3, либо (по вашему выбору) любой более
+   поздней версии.
+
+   Grabin распространяется в надежде, что она будет полезной, но БЕЗО ВСЯКИХ ГАРАНТИЙ; даже без
+   неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ. Подробнее см. в
+   Стандартной общественной лицензии GNU.
+
+   Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+   обеспечением. Если это не так, см. <https://www.gnu.org/licenses/>.
+*/
+
+#include <grabin/statistics/window.hpp>
+
+#include <grabin/statistics/variance.hpp>
+#include <grabin/linear_algebra/math_vector.hpp>
+
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+    double test_value(int n)
+    {
+        return std::sin(n) * 10 + (n % 7);
+    }
+}
+
+TEST_CASE("window : variance over last elements")
+{
+    auto const W = 25;
+    auto const N = 400;
+
+    grabin::sliding_window_accumulator<grabin::variance_accumulator<double>, double> window(W);
+
+    CHECK(window.window_size() == W);
+    CHECK(window.size() == 0);
+
+    for(auto n = 0; n < N; ++ n)
+    {
+        window(test_value(n));
+
+        grabin::variance_accumulator<double> expected;
+
+        for(auto k = std::max(0, n + 1 - W); k <= n; ++ k)
+        {
+            expected(test_value(k));
+        }
+
+        REQUIRE(window.size() == static_cast<std::size_t>(expected.count()));
+        REQUIRE(window.accumulator().count() == expected.count());
+        CHECK(window.accumulator().mean() == Approx(expected.mean()));
+        CHECK(window.accumulator().variance() == Approx(expected.variance()).margin(1e-10));
+    }
+
+    using Mean_window = grabin::sliding_window_accumulator<grabin::mean_accumulator<double>, double>;
+    CHECK_THROWS_AS(Mean_window(0), std::logic_error);
+}
+
+TEST_CASE("window : vectors")
+{
+    using Vector = grabin::math_vector<double>;
+    using Accumulator = grabin::variance_accumulator<Vector>;
+
+    auto const W = 10;
+
+    grabin::sliding_window_accumulator<Accumulator, Vector> window(W, Accumulator(Vector(2)));
+
+    std::vector<Vector> xs;
+
+    for(auto n = 0; n < 100; ++ n)
+    {
+        xs.push_back(Vector{test_value(n), test_value(2 * n + 1)});
+        window(xs.back());
+    }
+
+    Accumulator expected(Vector(2));
+
+    for(auto k = xs.size() - W; k < xs.size(); ++ k)
+    {
+        expected(xs[k]);
+    }
+
+    auto const & acc = window.accumulator();
+
+    REQUIRE(acc.count() == W);
+
+    for(auto i = 0; i < 2; ++ i)
+    {
+        CHECK(acc.mean()[i] == Approx(expected.mean()[i]));
+
+        for(auto j = 0; j <= i; ++ j)
+        {
+            CHECK(acc.variance()(i, j) == Approx(expected.variance()(i, j)));
+        }
+    }
+}
+
+TEST_CASE("window : minimum and maximum with two stacks")
+{
+    auto const W = 17;
+
+    grabin::sliding_window_accumulator<grabin::queue_min_accumulator<int>, int>
+        min_window(W, grabin::queue_min_accumulator<int>(W));
+    grabin::sliding_window_accumulator<grabin::queue_max_accumulator<int>, int> max_window(W);
+
+    std::vector<int> xs;
+
+    for(auto n = 0; n < 500; ++ n)
+    {
+        xs.push_back((n * 37 + n * n * 11) % 101);
+
+        min_window(xs.back());
+        max_window(xs.back());
+
+        auto const first = xs.end() - std::min<std::ptrdiff_t>(W, xs.size());
+
+        REQUIRE(min_window.accumulator().count() == static_cast<std::size_t>(xs.end() - first));
+        CHECK(min_window.accumulator().value() == *std::min_element(first, xs.end()));
+        CHECK(max_window.accumulator().value() == *std::max_element(first, xs.end()));
+    }
+}
+
+TEST_CASE("window : queue fold preserves the order of operands")
+{
+    grabin::queue_fold_accumulator<std::string, std::plus<>> acc;
+
+    acc("a")("b")("c");
+    CHECK(acc.value() == "abc");
+
+    acc.remove("a");
+    CHECK(acc.value() == "bc");
+
+    acc("d");
+    CHECK(acc.value() == "bcd");
+
+    acc.remove("b").remove("c");
+    CHECK(acc.value() == "d");
+}
+
+TEST_CASE("window : elements received during a time span")
+{
+    using Clock = std::chrono::steady_clock;
+    using Accumulator = grabin::mean_accumulator<double>;
+
+    auto const t0 = Clock::time_point{};
+
+    grabin::time_window_accumulator<Accumulator, Clock::time_point, double>
+        window(std::chrono::seconds(10));
+
+    CHECK(window.span() == std::chrono::seconds(10));
+
+    window(t0, 1.0);
+    window(t0 + std::chrono::seconds(3), 2.0);
+    window(t0 + std::chrono::seconds(3), 3.0);
+    window(t0 + std::chrono::seconds(9), 6.0);
+
+    CHECK(window.size() == 4);
+    CHECK(window.accumulator().mean() == 3.0);
+
+    window(t0 + std::chrono::seconds(10), 8.0);
+
+    CHECK(window.size() == 4);
+    CHECK(window.accumulator().mean() == Approx(19.0 / 4));
+
+    window.expire(t0 + std::chrono::seconds(13));
+
+    CHECK(window.size() == 2);
+    CHECK(window.accumulator().mean() == Approx(7.0));
+
+    window.expire(t0 + std::chrono::seconds(100));
+
+    CHECK(window.size() == 0);
+    CHECK(window.accumulator().count() == 0);
+
+    CHECK_THROWS_AS((grabin::time_window_accumulator<Accumulator, double, double>(0.0)),
+                    std::logic_error);
+}
+
+TEST_CASE("window : variance over a time span with small initial capacity")
+{
+    using Accumulator = grabin::variance_accumulator<double>;
+
+    grabin::time_window_accumulator<Accumulator, double, double> window(2.5, Accumulator(), 4);
+
+    for(auto n = 0; n < 50; ++ n)
+    {
+        window(0.5 * n, test_value(n));
+    }
+
+    Accumulator expected;
+
+    for(auto n = 45; n < 50; ++ n)
+    {
+        expected(test_value(n));
+    }
+
+    CHECK(window.size() == 5);
+    CHECK(window.accumulator().mean() == Approx(expected.mean()));
+    CHECK(window.accumulator().variance() == Approx(expected.variance()));
+}